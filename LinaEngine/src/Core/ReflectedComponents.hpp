@@ -0,0 +1,278 @@
+// Stable component IDs & dispatch table of the reflection registry, generated by Lina Header Tool, do not modify.
+#pragma once
+
+#include "Core/CommonECS.hpp"
+#include "ReflectedTypeTable.hpp"
+#include <bitset>
+#include <cereal/archives/portable_binary.hpp>
+#include <cstdint>
+#include <entt/entity/snapshot.hpp>
+#include <istream>
+#include <vector>
+
+namespace Lina::ECS
+{
+    struct DirectionalLightComponent;
+    struct LightComponent;
+    struct PointLightComponent;
+    struct SpotLightComponent;
+}
+
+namespace Lina
+{
+    template <>
+    const ReflectedProperty* GetReflectedProperties<ECS::DirectionalLightComponent>(uint32_t& count);
+
+    template <>
+    const ReflectedBulkKernels* GetReflectedBulkKernels<ECS::DirectionalLightComponent>(uint32_t& count);
+
+    template <>
+    const ReflectedDeltaCodec* GetReflectedDeltaCodec<ECS::DirectionalLightComponent>();
+
+    template <>
+    const ReflectedQuantizedField* GetReflectedQuantizedFields<ECS::DirectionalLightComponent>(uint32_t& count);
+
+    template <>
+    const ReflectedProperty* GetReflectedProperties<ECS::LightComponent>(uint32_t& count);
+
+    template <>
+    const ReflectedBulkKernels* GetReflectedBulkKernels<ECS::LightComponent>(uint32_t& count);
+
+    template <>
+    const ReflectedDeltaCodec* GetReflectedDeltaCodec<ECS::LightComponent>();
+
+    template <>
+    const ReflectedQuantizedField* GetReflectedQuantizedFields<ECS::LightComponent>(uint32_t& count);
+
+    template <>
+    const ReflectedProperty* GetReflectedProperties<ECS::PointLightComponent>(uint32_t& count);
+
+    template <>
+    const ReflectedBulkKernels* GetReflectedBulkKernels<ECS::PointLightComponent>(uint32_t& count);
+
+    template <>
+    const ReflectedDeltaCodec* GetReflectedDeltaCodec<ECS::PointLightComponent>();
+
+    template <>
+    const ReflectedQuantizedField* GetReflectedQuantizedFields<ECS::PointLightComponent>(uint32_t& count);
+
+    template <>
+    const ReflectedProperty* GetReflectedProperties<ECS::SpotLightComponent>(uint32_t& count);
+
+    template <>
+    const ReflectedBulkKernels* GetReflectedBulkKernels<ECS::SpotLightComponent>(uint32_t& count);
+
+    template <>
+    const ReflectedDeltaCodec* GetReflectedDeltaCodec<ECS::SpotLightComponent>();
+
+    template <>
+    const ReflectedQuantizedField* GetReflectedQuantizedFields<ECS::SpotLightComponent>(uint32_t& count);
+
+#ifndef LINA_REFLECTED_COMPONENT_TYPES
+#define LINA_REFLECTED_COMPONENT_TYPES
+
+    struct ReflectedComponentFunctions
+    {
+        void (*m_clone)(ECS::Entity from, ECS::Entity to);
+        void (*m_serialize)(entt::snapshot& snapshot, cereal::PortableBinaryOutputArchive& archive);
+        void (*m_deserialize)(entt::snapshot_loader& loader, cereal::PortableBinaryInputArchive& archive); // Drops sections of another type or schema.
+        ReflectedSectionResult (*m_deserializeSection)(std::istream& stream, entt::snapshot_loader& loader, cereal::PortableBinaryInputArchive& archive); // stream is the archive's.
+        void (*m_deserializeLegacy)(entt::snapshot_loader& loader, cereal::PortableBinaryInputArchive& archive); // Levels saved without sections.
+        void (*m_setEnabled)(ECS::Entity entity, bool enabled);
+        void (*m_reset)(ECS::Entity entity);
+        void (*m_resetEntities)(const ECS::Entity* entities, uint32_t count);
+        bool (*m_has)(ECS::Entity entity);
+        void (*m_remove)(ECS::Entity entity);
+        const ReflectedProperty* (*m_properties)(uint32_t& count);
+        const ReflectedBulkKernels* (*m_bulkKernels)(uint32_t propertyHash); // nullptr if the property is not numeric.
+        const ReflectedDeltaCodec* (*m_deltaCodec)();
+        bool (*m_captureDelta)(ECS::Entity entity, const void* baseline, std::vector<uint8_t>& out); // nullptr baseline for the defaults.
+        size_t (*m_applyDeltas)(const uint8_t* data, size_t size); // Returns the number of records applied.
+        const ReflectedQuantizedField* (*m_quantizedFields)(uint32_t& count);
+        ReflectedMemoryStats (*m_memoryStats)();
+        void (*m_add)(ECS::Entity entity); // nullptr if the component can not be added from the editor.
+    };
+
+    struct ReflectedPooledClass
+    {
+        uint32_t m_typeHash;
+        const char* m_name;
+        ReflectedMemoryStats (*m_memoryStats)();
+    };
+
+    // Serialized components are written as sections: type hash, schema hash, payload size & the payload itself.
+    struct ReflectedSection
+    {
+        uint32_t m_typeHash   = 0;
+        uint32_t m_schemaHash = 0;
+        uint64_t m_size       = 0;
+    };
+
+    constexpr std::streamoff REFLECTED_SECTION_HEADER_SIZE = 16;
+
+    // Reads the header of the next section & rewinds, so the section can still be deserialized or skipped.
+    inline ReflectedSection PeekSection(std::istream& stream, cereal::PortableBinaryInputArchive& archive)
+    {
+        ReflectedSection section;
+        archive(section.m_typeHash, section.m_schemaHash, section.m_size);
+        stream.seekg(-REFLECTED_SECTION_HEADER_SIZE, std::ios::cur);
+        return section;
+    }
+
+    // Moves past the next section without decoding its payload.
+    inline void SkipSection(std::istream& stream, cereal::PortableBinaryInputArchive& archive)
+    {
+        const ReflectedSection section = PeekSection(stream, archive);
+        stream.seekg(REFLECTED_SECTION_HEADER_SIZE + static_cast<std::streamoff>(section.m_size), std::ios::cur);
+    }
+#endif
+} // namespace Lina
+
+namespace Lina::LinaEngineReflection
+{
+    constexpr uint32_t REFLECTED_COMPONENT_COUNT = 4;
+
+    // Reflected classes living in ECS pools without being components, e.g. EntityDataComponent.
+    constexpr uint32_t REFLECTED_POOLED_CLASS_COUNT = 1;
+
+    // One bit per reflected component, indexed by its ID.
+    typedef std::bitset<REFLECTED_COMPONENT_COUNT> ReflectedComponentMask;
+
+    template <typename T>
+    struct ReflectedComponentID;
+
+    template <>
+    struct ReflectedComponentID<ECS::DirectionalLightComponent>
+    {
+        static constexpr uint32_t value = 0;
+    };
+
+    template <>
+    struct ReflectedComponentID<ECS::LightComponent>
+    {
+        static constexpr uint32_t value = 1;
+    };
+
+    template <>
+    struct ReflectedComponentID<ECS::PointLightComponent>
+    {
+        static constexpr uint32_t value = 2;
+    };
+
+    template <>
+    struct ReflectedComponentID<ECS::SpotLightComponent>
+    {
+        static constexpr uint32_t value = 3;
+    };
+
+    // Defined by the registry, returns the module's type table & its size, see ReflectedTypeTable.hpp.
+    ReflectedTypeEntry* GetReflectedTypes(uint32_t& count);
+
+    inline ReflectedTypeEntry* FindReflectedType(uint32_t hash)
+    {
+        uint32_t            count   = 0;
+        ReflectedTypeEntry* entries = GetReflectedTypes(count);
+        return Lina::FindReflectedType(entries, count, hash);
+    }
+
+    inline bool EnsureRegistered(uint32_t hash)
+    {
+        uint32_t            count   = 0;
+        ReflectedTypeEntry* entries = GetReflectedTypes(count);
+        return Lina::EnsureRegistered(entries, count, hash);
+    }
+
+    inline bool UnregisterReflectedType(uint32_t hash)
+    {
+        uint32_t            count   = 0;
+        ReflectedTypeEntry* entries = GetReflectedTypes(count);
+        return Lina::UnregisterReflectedType(entries, count, hash);
+    }
+
+    inline void RegisterReflectedTypes()
+    {
+        uint32_t            count   = 0;
+        ReflectedTypeEntry* entries = GetReflectedTypes(count);
+        Lina::RegisterReflectedTypes(entries, count);
+    }
+
+    inline uint32_t ReregisterReflectedHeader(const char* include)
+    {
+        uint32_t            count   = 0;
+        ReflectedTypeEntry* entries = GetReflectedTypes(count);
+        return Lina::ReregisterReflectedHeader(entries, count, include);
+    }
+
+    // Indexed by ReflectedComponentID<T>::value.
+    constexpr uint32_t g_reflectedComponentTypeHashes[REFLECTED_COMPONENT_COUNT] = {
+        3048757949u, // ECS::DirectionalLightComponent
+        995979701u, // ECS::LightComponent
+        3232218151u, // ECS::PointLightComponent
+        1356326053u, // ECS::SpotLightComponent
+    };
+
+    constexpr uint32_t g_reflectedComponentSchemas[REFLECTED_COMPONENT_COUNT] = {
+        2157534642u,
+        794206987u,
+        2445915604u,
+        124682263u,
+    };
+
+    // ID of the component a section was written for, -1 if the component is unknown or its schema has changed since.
+    inline int32_t FindSectionComponent(const ReflectedSection& section)
+    {
+        for (uint32_t i = 0; i < REFLECTED_COMPONENT_COUNT; i++)
+        {
+            if (g_reflectedComponentTypeHashes[i] == section.m_typeHash && section.m_typeHash != 0)
+                return g_reflectedComponentSchemas[i] == section.m_schemaHash ? static_cast<int32_t>(i) : -1;
+        }
+
+        return -1;
+    }
+
+    // Defined by the registry, indexed by ReflectedComponentID<T>::value.
+    extern const ReflectedComponentFunctions g_reflectedComponentFunctions[REFLECTED_COMPONENT_COUNT];
+
+    // Deserializes the next section into the component it was written for, looked up by its type hash. Sections of
+    // unknown components & outdated schemas are skipped, the result tells which happened.
+    inline ReflectedSectionResult LoadReflectedSection(std::istream& stream, entt::snapshot_loader& loader, cereal::PortableBinaryInputArchive& archive)
+    {
+        const ReflectedSection section = PeekSection(stream, archive);
+
+        for (uint32_t i = 0; i < REFLECTED_COMPONENT_COUNT; i++)
+        {
+            if (g_reflectedComponentTypeHashes[i] == section.m_typeHash && section.m_typeHash != 0)
+                return g_reflectedComponentFunctions[i].m_deserializeSection(stream, loader, archive);
+        }
+
+        SkipSection(stream, archive);
+        return ReflectedSectionResult::Unknown;
+    }
+
+    // Defined by the registry.
+    extern const ReflectedPooledClass g_reflectedPooledClasses[REFLECTED_POOLED_CLASS_COUNT];
+
+    // Fills stats, indexed by ReflectedComponentID<T>::value, & returns the bytes of all pools including their estimated owned heap.
+    // Pools of g_reflectedPooledClasses are counted in the total & written to classStats, if given, in the same order.
+    inline size_t SampleReflectedMemoryStats(ReflectedMemoryStats (&stats)[REFLECTED_COMPONENT_COUNT], ReflectedMemoryStats* classStats = nullptr)
+    {
+        size_t total = 0;
+
+        for (uint32_t i = 0; i < REFLECTED_COMPONENT_COUNT; i++)
+        {
+            stats[i] = g_reflectedComponentFunctions[i].m_memoryStats ? g_reflectedComponentFunctions[i].m_memoryStats() : ReflectedMemoryStats();
+            total += stats[i].m_storageBytes + stats[i].m_ownedHeapBytes;
+        }
+
+        for (uint32_t i = 0; i < REFLECTED_POOLED_CLASS_COUNT; i++)
+        {
+            const ReflectedMemoryStats pool = g_reflectedPooledClasses[i].m_memoryStats();
+            total += pool.m_storageBytes + pool.m_ownedHeapBytes;
+
+            if (classStats != nullptr)
+                classStats[i] = pool;
+        }
+
+        return total;
+    }
+} // namespace Lina::LinaEngineReflection
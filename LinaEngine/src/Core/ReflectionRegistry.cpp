@@ -28,6 +28,7 @@ SOFTWARE.
 
 #include "Core/ReflectionRegistry.hpp"
 #include "Core/CommonECS.hpp"
+#include "ReflectedTypeTable.hpp"
 #include "ECS/Registry.hpp"
 #include "Log/Log.hpp"
 #include "Utility/StringId.hpp"
@@ -35,6 +36,14 @@ SOFTWARE.
 #include <entt/meta/factory.hpp>
 #include <entt/meta/meta.hpp>
 #include <entt/meta/node.hpp>
+#include <algorithm>
+#include <cstring>
+#include <limits>
+#include <memory>
+#include <sstream>
+#include <string>
+#include <type_traits>
+#include <vector>
 
 /// <summary>
 /// *****************************************************************************
@@ -48,13 +57,18 @@ SOFTWARE.
 /// </summary>
 
 //INC_BEGIN - !! DO NOT MODIFY THIS LINE !!
-#include "Depth1/Depth2/Test2.hpp"
-#include "Depth1/Depth2/Test2.hpp"
-#include "Depth1/Depth2/Test2.hpp"
-#include "Depth1/Depth2/Test2.hpp"
+#include "ReflectedComponents.hpp"
 #include "Depth1/Depth2/Test.hpp"
+#include "Depth1/Depth2/Test2.hpp"
 //INC_END - !! DO NOT MODIFY THIS LINE !!
 
+// Titles, icons & tooltips are only read by the editor, other builds do not register them.
+#ifdef LINA_EDITOR
+#define REF_EDITOR_PROPS(...) .props(__VA_ARGS__)
+#else
+#define REF_EDITOR_PROPS(...)
+#endif
+
 namespace Lina
 {
     using namespace entt::literals;
@@ -66,16 +80,170 @@ namespace Lina
         ECS::Registry::Get()->template emplace<Type>(to, component);
     }
 
+    // Ranged properties are bit-packed after the other members, see GetReflectedQuantizedFields.
     template <typename Type>
-    void REF_SerializeComponent(entt::snapshot& snapshot, cereal::PortableBinaryOutputArchive& archive)
+    void REF_ArchiveQuantized(cereal::PortableBinaryOutputArchive& archive, const Type& instance)
     {
-        snapshot.component<Type>(archive);
+        uint32_t                       count  = 0;
+        const ReflectedQuantizedField* fields = GetReflectedQuantizedFields<Type>(count);
+        std::vector<uint8_t>           bytes;
+        {
+            ReflectedBitWriter writer(bytes);
+            EncodeQuantized(fields, count, &instance, writer);
+        }
+
+        archive(cereal::binary_data(bytes.data(), bytes.size()));
     }
 
     template <typename Type>
+    void REF_ArchiveQuantized(cereal::PortableBinaryInputArchive& archive, Type& instance)
+    {
+        uint32_t                       count  = 0;
+        uint32_t                       bits   = 0;
+        const ReflectedQuantizedField* fields = GetReflectedQuantizedFields<Type>(count);
+
+        for (uint32_t i = 0; i < count; i++)
+            bits += fields[i].m_bits;
+
+        std::vector<uint8_t> bytes((bits + 7) / 8);
+        archive(cereal::binary_data(bytes.data(), bytes.size()));
+
+        ReflectedBitReader reader(bytes.data(), bytes.size());
+        DecodeQuantized(fields, count, &instance, reader);
+    }
+
+    // Forwards entities & counts to the archive as they are, instances of Type are archived member by member in the
+    // order the schema hash covers. Used for components that cereal can not archive on their own.
+    template <typename Type, typename Archive, bool Quantized, auto... Fields>
+    struct REF_FieldArchive
+    {
+        Archive& m_archive;
+
+        template <typename... Args>
+        void operator()(Args&&... args)
+        {
+            (Forward(args), ...);
+        }
+
+        template <typename Arg>
+        void Forward(Arg& arg)
+        {
+            if constexpr (std::is_same_v<std::remove_const_t<Arg>, Type>)
+            {
+                m_archive((arg.*Fields)...);
+
+                if constexpr (Quantized)
+                    REF_ArchiveQuantized<Type>(m_archive, arg);
+            }
+            else
+                m_archive(arg);
+        }
+    };
+
+    // The payload of a section is the component's own serialization, e.g. its serialize member, so that state which is not
+    // reflected is saved as well. Components without one are archived member by member instead.
+    template <typename Type, bool Quantized, auto... Fields>
+    void REF_SavePayload(entt::snapshot& snapshot, cereal::PortableBinaryOutputArchive& archive)
+    {
+        if constexpr (cereal::traits::is_output_serializable<Type, cereal::PortableBinaryOutputArchive>::value)
+            snapshot.component<Type>(archive);
+        else
+        {
+            REF_FieldArchive<Type, cereal::PortableBinaryOutputArchive, Quantized, Fields...> fieldArchive{archive};
+            snapshot.component<Type>(fieldArchive);
+        }
+    }
+
+    template <typename Type, bool Quantized, auto... Fields>
+    void REF_LoadPayload(entt::snapshot_loader& loader, cereal::PortableBinaryInputArchive& archive)
+    {
+        if constexpr (cereal::traits::is_input_serializable<Type, cereal::PortableBinaryInputArchive>::value)
+            loader.component<Type>(archive);
+        else
+        {
+            REF_FieldArchive<Type, cereal::PortableBinaryInputArchive, Quantized, Fields...> fieldArchive{archive};
+            loader.component<Type>(fieldArchive);
+        }
+    }
+
+    template <typename Type, bool Quantized, auto... Fields>
+    void REF_LoadPayload(const std::string& data, entt::snapshot_loader& loader)
+    {
+        std::stringstream                  payload(data);
+        cereal::PortableBinaryInputArchive payloadArchive(payload);
+        REF_LoadPayload<Type, Quantized, Fields...>(loader, payloadArchive);
+    }
+
+    template <typename Type, uint32_t TypeHash, uint32_t Schema, bool Quantized, auto... Fields>
+    void REF_SerializeComponent(entt::snapshot& snapshot, cereal::PortableBinaryOutputArchive& archive)
+    {
+        // A length-prefixed section tagged with the type & schema hash, see ReflectedSection.
+        std::stringstream payload;
+        {
+            cereal::PortableBinaryOutputArchive payloadArchive(payload);
+            REF_SavePayload<Type, Quantized, Fields...>(snapshot, payloadArchive);
+        }
+
+        const std::string data = payload.str();
+        archive(TypeHash, Schema, static_cast<uint64_t>(data.size()));
+        archive(cereal::binary_data(data.data(), data.size()));
+    }
+
+    // Reads the next section, which is expected to be one of Type as it can not be put back without the archive's stream.
+    // A section of another type or schema is consumed & dropped with a warning, REF_DeserializeSection leaves it instead.
+    template <typename Type, uint32_t TypeHash, uint32_t Schema, bool Quantized, auto... Fields>
     void REF_DeserializeComponent(entt::snapshot_loader& loader, cereal::PortableBinaryInputArchive& archive)
     {
-        loader.component<Type>(archive);
+        uint32_t typeHash = 0;
+        uint32_t schema   = 0;
+        uint64_t size     = 0;
+        archive(typeHash, schema, size);
+
+        std::string data(static_cast<size_t>(size), '\0');
+        archive(cereal::binary_data(&data[0], data.size()));
+
+        if (typeHash != TypeHash || schema != Schema)
+        {
+            LINA_WARN("Dropping a serialized section of type {0} read as type {1}, its type or schema does not match.", typeHash, TypeHash);
+            return;
+        }
+
+        REF_LoadPayload<Type, Quantized, Fields...>(data, loader);
+    }
+
+    template <typename Type, uint32_t TypeHash, uint32_t Schema, bool Quantized, auto... Fields>
+    ReflectedSectionResult REF_DeserializeSection(std::istream& stream, entt::snapshot_loader& loader, cereal::PortableBinaryInputArchive& archive)
+    {
+        // stream is the one archive reads from, the header is peeked so that another type's section is left untouched.
+        uint32_t typeHash = 0;
+        uint32_t schema   = 0;
+        uint64_t size     = 0;
+        archive(typeHash, schema, size);
+
+        if (typeHash != TypeHash)
+        {
+            stream.seekg(-static_cast<std::streamoff>(sizeof(typeHash) + sizeof(schema) + sizeof(size)), std::ios::cur);
+            return ReflectedSectionResult::OtherType;
+        }
+
+        if (schema != Schema)
+        {
+            LINA_WARN("Skipping the serialized section of type {0}, it was written with another schema.", TypeHash);
+            stream.seekg(static_cast<std::streamoff>(size), std::ios::cur);
+            return ReflectedSectionResult::SchemaChanged;
+        }
+
+        std::string data(static_cast<size_t>(size), '\0');
+        archive(cereal::binary_data(&data[0], data.size()));
+        REF_LoadPayload<Type, Quantized, Fields...>(data, loader);
+        return ReflectedSectionResult::Loaded;
+    }
+
+    // Levels saved before sections were introduced hold the bare snapshot of each component, without a section header.
+    template <typename Type, uint32_t TypeHash, uint32_t Schema, bool Quantized, auto... Fields>
+    void REF_DeserializeLegacy(entt::snapshot_loader& loader, cereal::PortableBinaryInputArchive& archive)
+    {
+        REF_LoadPayload<Type, Quantized, Fields...>(loader, archive);
     }
 
     template <typename Type>
@@ -102,20 +270,78 @@ namespace Lina
         return ECS::Registry::Get()->all_of<Type>(entity);
     }
 
+    template <typename Type>
+    const Type& REF_Prototype()
+    {
+        static const Type prototype{};
+        return prototype;
+    }
+
     template <typename Type>
     void REF_Reset(ECS::Entity entity)
     {
-        TypeID tid = GetTypeID<Type>();
+        ECS::Registry::Get()->template replace<Type>(entity, REF_Prototype<Type>());
+    }
 
-        if (tid == GetTypeID<EntityDataComponent>())
+    template <typename Type>
+    void REF_ResetEntities(const ECS::Entity* entities, uint32_t count)
+    {
+        // Replaces like REF_Reset, so update listeners see every reset. Entities without the component are skipped.
+        auto*       registry  = ECS::Registry::Get();
+        auto&       storage   = registry->template storage<Type>();
+        const Type& prototype = REF_Prototype<Type>();
+
+        for (uint32_t i = 0; i < count; i++)
         {
-            EntityDataComponent& comp = ECS::Registry::Get()->get<EntityDataComponent>(entity);
-            comp.SetLocalLocation(Vector3::Zero);
-            comp.SetLocalRotation(Quaternion());
-            comp.SetLocalScale(Vector3::One);
+            if (storage.contains(entities[i]))
+                registry->template replace<Type>(entities[i], prototype);
         }
-        else
-            ECS::Registry::Get()->template replace<Type>(entity, Type());
+    }
+
+    template <typename Type, typename = void>
+    struct REF_HasOwnedHeap : std::false_type
+    {
+    };
+
+    // Components owning heap memory report it through a GetOwnedHeapSize() const member.
+    template <typename Type>
+    struct REF_HasOwnedHeap<Type, std::void_t<decltype(std::declval<const Type&>().GetOwnedHeapSize())>> : std::true_type
+    {
+    };
+
+    // Instances GetOwnedHeapSize() is called on per sample, so sampling a pool takes constant time.
+    constexpr size_t REF_OwnedHeapSamples = 64;
+
+    template <typename Type>
+    ReflectedMemoryStats REF_MemoryStats()
+    {
+        const auto&          storage = ECS::Registry::Get()->template storage<Type>();
+        ReflectedMemoryStats stats;
+        stats.m_instanceCount = storage.size();
+        stats.m_instanceSize  = sizeof(Type);
+        stats.m_capacity      = storage.capacity();
+        stats.m_storageBytes  = stats.m_capacity * sizeof(Type);
+
+        if constexpr (REF_HasOwnedHeap<Type>::value)
+        {
+            // Measured on instances spread evenly over the pool & scaled to its size, exact for small pools.
+            const size_t samples = std::min(stats.m_instanceCount, REF_OwnedHeapSamples);
+
+            if (samples != 0)
+            {
+                const size_t stride = stats.m_instanceCount / samples;
+                const auto   begin  = storage.begin();
+                size_t       heap   = 0;
+
+                for (size_t i = 0; i < samples; i++)
+                    heap += static_cast<size_t>((*(begin + static_cast<std::ptrdiff_t>(i * stride))).GetOwnedHeapSize());
+
+                stats.m_ownedHeapBytes   = heap * stats.m_instanceCount / samples;
+                stats.m_ownedHeapSamples = samples;
+            }
+        }
+
+        return stats;
     }
 
     template <typename Type>
@@ -140,80 +366,783 @@ namespace Lina
 
     }
 
-    void ReflectionRegistry::RegisterReflectedComponents()
+    template <typename Type, typename Member, typename Owner>
+    ReflectedProperty REF_Property(uint32_t hash, Member Owner::*member)
     {
-        //REGFUNC_BEGIN - !! DO NOT CHANGE THIS LINE !!
-entt::meta<ECS::SpotLightComponent>().type().props(std::make_pair("Title"_hs, "Spot Light Component"), std::make_pair("Icon"_hs,ICON_FA_EYE), std::make_pair("Category"_hs,"Lights"));
-entt::meta<ECS::SpotLightComponent>().data<&ECS::SpotLightComponent::m_isEnabled>("m_isEnabled"_hs);
-entt::meta<ECS::SpotLightComponent>().data<&ECS::SpotLightComponent::m_distance>("m_distance"_hs).props(std::make_pair("Title"_hs,"Distance"),std::make_pair("Type"_hs,"Float"),std::make_pair("Tooltip"_hs,"Light Distance"),std::make_pair("Depends"_hs,""_hs));
-entt::meta<ECS::SpotLightComponent>().data<&ECS::SpotLightComponent::m_cutoff>("m_cutoff"_hs).props(std::make_pair("Title"_hs,"Cutoff"),std::make_pair("Type"_hs,"Float"),std::make_pair("Tooltip"_hs,"The light will gradually dim from the edges of the cone defined by the Cutoff, to the cone defined by the Outer Cutoff."),std::make_pair("Depends"_hs,""_hs));
-entt::meta<ECS::SpotLightComponent>().data<&ECS::SpotLightComponent::m_outerCutoff>("m_outerCutoff"_hs).props(std::make_pair("Title"_hs,"Outer Cutoff"),std::make_pair("Type"_hs,"Float"),std::make_pair("Tooltip"_hs,"The light will gradually dim from the edges of the cone defined by the Cutoff, to the cone defined by the Outer Cutoff."),std::make_pair("Depends"_hs,""_hs));
-entt::meta<ECS::SpotLightComponent>().func<&REF_CloneComponent<ECS::SpotLightComponent>, entt::as_void_t>("clone"_hs);
-entt::meta<ECS::SpotLightComponent>().func<&REF_SerializeComponent<ECS::SpotLightComponent>, entt::as_void_t>("serialize"_hs);
-entt::meta<ECS::SpotLightComponent>().func<&REF_DeserializeComponent<ECS::SpotLightComponent>, entt::as_void_t>("deserialize"_hs);
-entt::meta<ECS::SpotLightComponent>().func<&REF_SetEnabled<ECS::SpotLightComponent>, entt::as_void_t>("setEnabled"_hs);
-entt::meta<ECS::SpotLightComponent>().func<&REF_Get<ECS::SpotLightComponent>, entt::as_ref_t>("get"_hs);
-entt::meta<ECS::SpotLightComponent>().func<&REF_Reset<ECS::SpotLightComponent>, entt::as_void_t>("reset"_hs);
-entt::meta<ECS::SpotLightComponent>().func<&REF_Has<ECS::SpotLightComponent>, entt::as_void_t>("has"_hs);
-entt::meta<ECS::SpotLightComponent>().func<&REF_Remove<ECS::SpotLightComponent>, entt::as_void_t>("remove"_hs);
-entt::meta<ECS::SpotLightComponent>().func<&REF_Copy<ECS::SpotLightComponent>, entt::as_void_t>("copy"_hs);
-entt::meta<ECS::SpotLightComponent>().func<&REF_Paste<ECS::SpotLightComponent>, entt::as_void_t>("paste"_hs);
-entt::meta<ECS::SpotLightComponent>().func<&REF_Add<ECS::SpotLightComponent>, entt::as_void_t>("add"_hs);
-entt::meta<ECS::SpotLightComponent>().func<&REF_ValueChanged<ECS::SpotLightComponent>, entt::as_void_t>("add"_hs);
-entt::meta<ECS::LightComponent>().type().props(std::make_pair("Title"_hs, "Light Component"), std::make_pair("Icon"_hs,ICON_FA_EYE), std::make_pair("Category"_hs,"Lights"));
+        const Type&       prototype = REF_Prototype<Type>();
+        const char*       base      = reinterpret_cast<const char*>(&prototype);
+        ReflectedProperty property;
+        property.m_hash   = hash;
+        property.m_offset = static_cast<uint32_t>(reinterpret_cast<const char*>(&(prototype.*member)) - base);
+        property.m_size   = static_cast<uint32_t>(sizeof(Member));
+        return property;
+    }
+
+    inline std::vector<ReflectedProperty> REF_SortProperties(std::vector<ReflectedProperty> properties)
+    {
+        std::sort(properties.begin(), properties.end(), [](const ReflectedProperty& a, const ReflectedProperty& b) { return a.m_offset < b.m_offset; });
+        return properties;
+    }
+
+    template <typename Type, typename Func>
+    void REF_ForEachRunUnsignaled(Func func)
+    {
+        // Components are stored in pages, hand out each contiguous run so that the loops over it can be vectorized.
+        // Writes through the runs bypass the registry, so no on_update signal is emitted for the touched entities.
+        auto&      storage = ECS::Registry::Get()->template storage<Type>();
+        auto       it      = storage.begin();
+        const auto last    = storage.end();
+
+        while (it != last)
+        {
+            Type*           first = std::addressof(*it);
+            const ptrdiff_t step  = it + 1 != last && std::addressof(*(it + 1)) == first - 1 ? -1 : 1;
+            ptrdiff_t       count = 1;
+
+            while (it + count != last && std::addressof(*(it + count)) == first + step * count)
+                count++;
+
+            func(step > 0 ? first : first - (count - 1), static_cast<size_t>(count));
+            it += count;
+        }
+    }
+
+    template <typename Type, auto Member>
+    struct REF_UnsignaledBulk
+    {
+        typedef std::remove_cv_t<std::remove_reference_t<decltype(std::declval<Type&>().*Member)>> Value;
+        static_assert(std::is_arithmetic_v<Value>, "Bulk kernels need an arithmetic property.");
+
+        static void Set(double value)
+        {
+            const Value v = static_cast<Value>(value);
+            REF_ForEachRunUnsignaled<Type>([v](Type* components, size_t count) {
+                for (size_t i = 0; i < count; i++)
+                    components[i].*Member = v;
+            });
+        }
+
+        static void Add(double value)
+        {
+            const Value v = static_cast<Value>(value);
+            REF_ForEachRunUnsignaled<Type>([v](Type* components, size_t count) {
+                for (size_t i = 0; i < count; i++)
+                    components[i].*Member += v;
+            });
+        }
+
+        static void Scale(double factor)
+        {
+            REF_ForEachRunUnsignaled<Type>([factor](Type* components, size_t count) {
+                for (size_t i = 0; i < count; i++)
+                    components[i].*Member = static_cast<Value>(components[i].*Member * factor);
+            });
+        }
+
+        static void Clamp(double min, double max)
+        {
+            const Value lo = static_cast<Value>(min);
+            const Value hi = static_cast<Value>(max);
+            REF_ForEachRunUnsignaled<Type>([lo, hi](Type* components, size_t count) {
+                for (size_t i = 0; i < count; i++)
+                    components[i].*Member = std::min(std::max(components[i].*Member, lo), hi);
+            });
+        }
+
+        static bool MinMax(double& min, double& max)
+        {
+            Value lo    = std::numeric_limits<Value>::max();
+            Value hi    = std::numeric_limits<Value>::lowest();
+            bool  found = false;
+            REF_ForEachRunUnsignaled<Type>([&](Type* components, size_t count) {
+                // Reduce into locals, the captured references would keep the loop from being vectorized.
+                Value runLo = lo;
+                Value runHi = hi;
+
+                for (size_t i = 0; i < count; i++)
+                {
+                    runLo = std::min(runLo, components[i].*Member);
+                    runHi = std::max(runHi, components[i].*Member);
+                }
+
+                lo    = runLo;
+                hi    = runHi;
+                found = true;
+            });
+
+            if (found)
+            {
+                min = static_cast<double>(lo);
+                max = static_cast<double>(hi);
+            }
+
+            return found;
+        }
+    };
+
+    template <typename Type, auto Member>
+    constexpr ReflectedBulkKernels REF_BulkKernels(uint32_t hash)
+    {
+        ReflectedBulkKernels kernels;
+        kernels.m_hash   = hash;
+        kernels.m_set    = &REF_UnsignaledBulk<Type, Member>::Set;
+        kernels.m_add    = &REF_UnsignaledBulk<Type, Member>::Add;
+        kernels.m_scale  = &REF_UnsignaledBulk<Type, Member>::Scale;
+        kernels.m_clamp  = &REF_UnsignaledBulk<Type, Member>::Clamp;
+        kernels.m_minMax = &REF_UnsignaledBulk<Type, Member>::MinMax;
+        return kernels;
+    }
+
+    template <typename Type>
+    const ReflectedBulkKernels* REF_FindBulkKernels(uint32_t propertyHash)
+    {
+        uint32_t                    count   = 0;
+        const ReflectedBulkKernels* kernels = GetReflectedBulkKernels<Type>(count);
+
+        for (uint32_t i = 0; i < count; i++)
+        {
+            if (kernels[i].m_hash == propertyHash)
+                return &kernels[i];
+        }
+
+        return nullptr;
+    }
+
+    template <typename Type, auto... Members>
+    struct REF_Delta
+    {
+        static constexpr size_t MASK_SIZE = (sizeof...(Members) + 7) / 8;
+
+        template <auto Member>
+        static void EncodeField(const Type& baseline, const Type& current, size_t index, uint8_t* mask, std::vector<uint8_t>& out)
+        {
+            typedef std::remove_cv_t<std::remove_reference_t<decltype(current.*Member)>> Value;
+            static_assert(std::is_trivially_copyable_v<Value>, "Delta encoding copies properties bytewise.");
+
+            // Bytewise, so that e.g. -0.0f & 0.0f differ and a replay reproduces the exact values.
+            if (std::memcmp(&(baseline.*Member), &(current.*Member), sizeof(Value)) == 0)
+                return;
+
+            const uint8_t* bytes = reinterpret_cast<const uint8_t*>(&(current.*Member));
+            mask[index / 8] |= static_cast<uint8_t>(1u << (index % 8));
+            out.insert(out.end(), bytes, bytes + sizeof(Value));
+        }
+
+        template <auto Member>
+        static void DecodeField(const uint8_t* data, size_t size, size_t index, size_t& offset, bool& valid, Type& target)
+        {
+            typedef std::remove_cv_t<std::remove_reference_t<decltype(target.*Member)>> Value;
+
+            if (!valid || (data[index / 8] & (1u << (index % 8))) == 0)
+                return;
+
+            if (offset + sizeof(Value) > size)
+            {
+                valid = false;
+                return;
+            }
+
+            std::memcpy(&(target.*Member), data + offset, sizeof(Value));
+            offset += sizeof(Value);
+        }
+
+        static bool Encode(const void* baseline, const void* current, std::vector<uint8_t>& out)
+        {
+            // The mask is filled while the changed values are appended behind it.
+            uint8_t      mask[MASK_SIZE + 1] = {};
+            const size_t maskOffset          = out.size();
+            size_t       index               = 0;
+            out.resize(maskOffset + MASK_SIZE);
+            (EncodeField<Members>(*static_cast<const Type*>(baseline), *static_cast<const Type*>(current), index++, mask, out), ...);
+
+            if (out.size() == maskOffset + MASK_SIZE)
+            {
+                out.resize(maskOffset);
+                return false;
+            }
+
+            std::memcpy(out.data() + maskOffset, mask, MASK_SIZE);
+            return true;
+        }
+
+        static size_t Decode(const uint8_t* data, size_t size, void* target)
+        {
+            if (size < MASK_SIZE)
+                return 0;
+
+            size_t offset = MASK_SIZE;
+            size_t index  = 0;
+            bool   valid  = true;
+            (DecodeField<Members>(data, size, index++, offset, valid, *static_cast<Type*>(target)), ...);
+            return valid ? offset : 0;
+        }
+    };
+
+    template <typename Type, auto... Members>
+    constexpr ReflectedDeltaCodec REF_DeltaCodec()
+    {
+        ReflectedDeltaCodec codec{};
+        codec.m_fieldCount = static_cast<uint32_t>(sizeof...(Members));
+        codec.m_encode     = &REF_Delta<Type, Members...>::Encode;
+        codec.m_decode     = &REF_Delta<Type, Members...>::Decode;
+        return codec;
+    }
+
+    template <typename Type>
+    bool REF_CaptureDelta(ECS::Entity entity, const void* baseline, std::vector<uint8_t>& out)
+    {
+        // A record is the entity followed by its delta, against the prototype if there is no baseline.
+        const size_t recordOffset = out.size();
+        out.resize(recordOffset + sizeof(ECS::Entity));
+        std::memcpy(out.data() + recordOffset, &entity, sizeof(ECS::Entity));
+
+        const Type& current = ECS::Registry::Get()->template get<Type>(entity);
+        if (GetReflectedDeltaCodec<Type>()->m_encode(baseline != nullptr ? baseline : &REF_Prototype<Type>(), &current, out))
+            return true;
+
+        out.resize(recordOffset);
+        return false;
+    }
+
+    template <typename Type>
+    size_t REF_ApplyDeltas(const uint8_t* data, size_t size)
+    {
+        // Decodes straight into the storage, update signals are not emitted. Entities missing the component
+        // get a default constructed one first, their records need to be captured against the prototype.
+        ECS::Registry*             registry = ECS::Registry::Get();
+        auto&                      storage  = registry->template storage<Type>();
+        const ReflectedDeltaCodec* codec    = GetReflectedDeltaCodec<Type>();
+        size_t                     offset   = 0;
+        size_t                     applied  = 0;
+
+        while (offset + sizeof(ECS::Entity) <= size)
+        {
+            ECS::Entity entity;
+            std::memcpy(&entity, data + offset, sizeof(ECS::Entity));
+            offset += sizeof(ECS::Entity);
+
+            Type&        target   = storage.contains(entity) ? storage.get(entity) : registry->template emplace<Type>(entity);
+            const size_t consumed = codec->m_decode(data + offset, size - offset, &target);
+
+            if (consumed == 0)
+                break;
+
+            offset += consumed;
+            applied++;
+        }
+
+        return applied;
+    }
+
+    template <typename Type, auto Member>
+    struct REF_Quantized
+    {
+        typedef std::remove_cv_t<std::remove_reference_t<decltype(std::declval<Type&>().*Member)>> Value;
+        static_assert(std::is_floating_point_v<Value>, "Only floating point properties can be quantized.");
+
+        static uint32_t Quantize(const void* instance, const ReflectedQuantizedField& field)
+        {
+            return QuantizeValue(static_cast<double>(static_cast<const Type*>(instance)->*Member), field);
+        }
+
+        static void Dequantize(void* instance, uint32_t value, const ReflectedQuantizedField& field)
+        {
+            static_cast<Type*>(instance)->*Member = static_cast<Value>(DequantizeValue(value, field));
+        }
+    };
+
+    template <typename Type, auto Member>
+    constexpr ReflectedQuantizedField REF_QuantizedField(uint32_t hash, double min, double max, uint32_t bits)
+    {
+        ReflectedQuantizedField field{};
+        field.m_hash       = hash;
+        field.m_min        = min;
+        field.m_max        = max;
+        field.m_bits       = bits;
+        field.m_quantize   = &REF_Quantized<Type, Member>::Quantize;
+        field.m_dequantize = &REF_Quantized<Type, Member>::Dequantize;
+        return field;
+    }
+
+    // Register_X & Unregister_X for every reflected type and their table, see ReflectedTypeTable.hpp.
+    //REGTYPES_BEGIN - !! DO NOT MODIFY THIS LINE !!
+template <>
+const ReflectedBulkKernels* GetReflectedBulkKernels<ECS::DirectionalLightComponent>(uint32_t& count);
+
+template <>
+const ReflectedDeltaCodec* GetReflectedDeltaCodec<ECS::DirectionalLightComponent>();
+
+template <>
+const ReflectedQuantizedField* GetReflectedQuantizedFields<ECS::DirectionalLightComponent>(uint32_t& count);
+
+template <>
+const ReflectedBulkKernels* GetReflectedBulkKernels<ECS::LightComponent>(uint32_t& count);
+
+template <>
+const ReflectedDeltaCodec* GetReflectedDeltaCodec<ECS::LightComponent>();
+
+template <>
+const ReflectedQuantizedField* GetReflectedQuantizedFields<ECS::LightComponent>(uint32_t& count);
+
+template <>
+const ReflectedBulkKernels* GetReflectedBulkKernels<ECS::PointLightComponent>(uint32_t& count);
+
+template <>
+const ReflectedDeltaCodec* GetReflectedDeltaCodec<ECS::PointLightComponent>();
+
+template <>
+const ReflectedQuantizedField* GetReflectedQuantizedFields<ECS::PointLightComponent>(uint32_t& count);
+
+template <>
+const ReflectedBulkKernels* GetReflectedBulkKernels<ECS::SpotLightComponent>(uint32_t& count);
+
+template <>
+const ReflectedDeltaCodec* GetReflectedDeltaCodec<ECS::SpotLightComponent>();
+
+template <>
+const ReflectedQuantizedField* GetReflectedQuantizedFields<ECS::SpotLightComponent>(uint32_t& count);
+
+namespace LinaEngineReflection
+{
+[[maybe_unused]] static constexpr char s_reflectionStrings[] =
+/* 0 */ "\0"
+/* 1 */ "Directional Light Component\0"
+/* 29 */ "Lights\0"
+/* 36 */ "Color\0"
+/* 42 */ "Intensity\0"
+/* 52 */ "Float\0"
+/* 58 */ "Draw Debug\0"
+/* 69 */ "Bool\0"
+/* 74 */ "Enables debug drawing for this component.\0"
+/* 116 */ "Cast Shadows\0"
+/* 129 */ "Enables dynamic shadow casting for this light.\0"
+/* 176 */ "Projection\0"
+/* 187 */ "Vector4\0"
+/* 195 */ "Defines shadow projection boundaries.\0"
+/* 233 */ "Shadow Near\0"
+/* 245 */ "Shadow Far\0"
+/* 256 */ "Light Component\0"
+/* 272 */ "Point Light Component\0"
+/* 294 */ "Distance\0"
+/* 303 */ "Light Distance\0"
+/* 318 */ "Bias\0"
+/* 323 */ "Defines the shadow crispiness.\0"
+/* 354 */ "Spot Light Component\0"
+/* 375 */ "Cutoff\0"
+/* 382 */ "The light will gradually dim from the edges of the cone defined by the Cutoff, to the cone defined by the Outer Cutoff.\0"
+/* 502 */ "Outer Cutoff\0"
+/* 515 */ "Entity Data Component\0"
+;
+
+void Register_ECS_DirectionalLightComponent()
+{
+entt::meta<ECS::DirectionalLightComponent>().type().props(std::make_pair("Category"_hs,&s_reflectionStrings[29])) REF_EDITOR_PROPS(std::make_pair("Title"_hs, &s_reflectionStrings[1]), std::make_pair("Icon"_hs,ICON_FA_EYE));
+entt::meta<ECS::DirectionalLightComponent>().data<&ECS::DirectionalLightComponent::m_isEnabled>("m_isEnabled"_hs);
+entt::meta<ECS::DirectionalLightComponent>().data<&ECS::DirectionalLightComponent::m_color>("m_color"_hs).props(std::make_pair("Type"_hs,&s_reflectionStrings[36]),std::make_pair("Depends"_hs,""_hs)) REF_EDITOR_PROPS(std::make_pair("Title"_hs,&s_reflectionStrings[36]),std::make_pair("Tooltip"_hs,&s_reflectionStrings[0]));
+entt::meta<ECS::DirectionalLightComponent>().data<&ECS::DirectionalLightComponent::m_intensity>("m_intensity"_hs).props(std::make_pair("Type"_hs,&s_reflectionStrings[52]),std::make_pair("Depends"_hs,""_hs)) REF_EDITOR_PROPS(std::make_pair("Title"_hs,&s_reflectionStrings[42]),std::make_pair("Tooltip"_hs,&s_reflectionStrings[0]));
+entt::meta<ECS::DirectionalLightComponent>().data<&ECS::DirectionalLightComponent::m_drawDebug>("m_drawDebug"_hs).props(std::make_pair("Type"_hs,&s_reflectionStrings[69]),std::make_pair("Depends"_hs,""_hs)) REF_EDITOR_PROPS(std::make_pair("Title"_hs,&s_reflectionStrings[58]),std::make_pair("Tooltip"_hs,&s_reflectionStrings[74]));
+entt::meta<ECS::DirectionalLightComponent>().data<&ECS::DirectionalLightComponent::m_castsShadows>("m_castsShadows"_hs).props(std::make_pair("Type"_hs,&s_reflectionStrings[69]),std::make_pair("Depends"_hs,""_hs)) REF_EDITOR_PROPS(std::make_pair("Title"_hs,&s_reflectionStrings[116]),std::make_pair("Tooltip"_hs,&s_reflectionStrings[129]));
+entt::meta<ECS::DirectionalLightComponent>().data<&ECS::DirectionalLightComponent::m_shadowOrthoProjection>("m_shadowOrthoProjection"_hs).props(std::make_pair("Type"_hs,&s_reflectionStrings[187]),std::make_pair("Depends"_hs,""_hs)) REF_EDITOR_PROPS(std::make_pair("Title"_hs,&s_reflectionStrings[176]),std::make_pair("Tooltip"_hs,&s_reflectionStrings[195]));
+entt::meta<ECS::DirectionalLightComponent>().data<&ECS::DirectionalLightComponent::m_shadowZNear>("m_shadowZNear"_hs).props(std::make_pair("Type"_hs,&s_reflectionStrings[52]),std::make_pair("Depends"_hs,""_hs)) REF_EDITOR_PROPS(std::make_pair("Title"_hs,&s_reflectionStrings[233]),std::make_pair("Tooltip"_hs,&s_reflectionStrings[0]));
+entt::meta<ECS::DirectionalLightComponent>().data<&ECS::DirectionalLightComponent::m_shadowZFar>("m_shadowZFar"_hs).props(std::make_pair("Type"_hs,&s_reflectionStrings[52]),std::make_pair("Depends"_hs,""_hs)) REF_EDITOR_PROPS(std::make_pair("Title"_hs,&s_reflectionStrings[245]),std::make_pair("Tooltip"_hs,&s_reflectionStrings[0]));
+entt::meta<ECS::DirectionalLightComponent>().func<&REF_CloneComponent<ECS::DirectionalLightComponent>, entt::as_void_t>("clone"_hs);
+entt::meta<ECS::DirectionalLightComponent>().func<&REF_SerializeComponent<ECS::DirectionalLightComponent, 3048757949u, 2157534642u, false, &ECS::DirectionalLightComponent::m_isEnabled, &ECS::DirectionalLightComponent::m_color, &ECS::DirectionalLightComponent::m_intensity, &ECS::DirectionalLightComponent::m_drawDebug, &ECS::DirectionalLightComponent::m_castsShadows, &ECS::DirectionalLightComponent::m_shadowOrthoProjection, &ECS::DirectionalLightComponent::m_shadowZNear, &ECS::DirectionalLightComponent::m_shadowZFar>, entt::as_void_t>("serialize"_hs);
+entt::meta<ECS::DirectionalLightComponent>().func<&REF_DeserializeComponent<ECS::DirectionalLightComponent, 3048757949u, 2157534642u, false, &ECS::DirectionalLightComponent::m_isEnabled, &ECS::DirectionalLightComponent::m_color, &ECS::DirectionalLightComponent::m_intensity, &ECS::DirectionalLightComponent::m_drawDebug, &ECS::DirectionalLightComponent::m_castsShadows, &ECS::DirectionalLightComponent::m_shadowOrthoProjection, &ECS::DirectionalLightComponent::m_shadowZNear, &ECS::DirectionalLightComponent::m_shadowZFar>, entt::as_void_t>("deserialize"_hs);
+entt::meta<ECS::DirectionalLightComponent>().func<&REF_DeserializeSection<ECS::DirectionalLightComponent, 3048757949u, 2157534642u, false, &ECS::DirectionalLightComponent::m_isEnabled, &ECS::DirectionalLightComponent::m_color, &ECS::DirectionalLightComponent::m_intensity, &ECS::DirectionalLightComponent::m_drawDebug, &ECS::DirectionalLightComponent::m_castsShadows, &ECS::DirectionalLightComponent::m_shadowOrthoProjection, &ECS::DirectionalLightComponent::m_shadowZNear, &ECS::DirectionalLightComponent::m_shadowZFar>>("deserializeSection"_hs);
+entt::meta<ECS::DirectionalLightComponent>().func<&REF_DeserializeLegacy<ECS::DirectionalLightComponent, 3048757949u, 2157534642u, false, &ECS::DirectionalLightComponent::m_isEnabled, &ECS::DirectionalLightComponent::m_color, &ECS::DirectionalLightComponent::m_intensity, &ECS::DirectionalLightComponent::m_drawDebug, &ECS::DirectionalLightComponent::m_castsShadows, &ECS::DirectionalLightComponent::m_shadowOrthoProjection, &ECS::DirectionalLightComponent::m_shadowZNear, &ECS::DirectionalLightComponent::m_shadowZFar>, entt::as_void_t>("deserializeLegacy"_hs);
+entt::meta<ECS::DirectionalLightComponent>().func<&REF_SetEnabled<ECS::DirectionalLightComponent>, entt::as_void_t>("setEnabled"_hs);
+entt::meta<ECS::DirectionalLightComponent>().func<&REF_Get<ECS::DirectionalLightComponent>, entt::as_ref_t>("get"_hs);
+entt::meta<ECS::DirectionalLightComponent>().func<&REF_Reset<ECS::DirectionalLightComponent>, entt::as_void_t>("reset"_hs);
+entt::meta<ECS::DirectionalLightComponent>().func<&REF_ResetEntities<ECS::DirectionalLightComponent>, entt::as_void_t>("resetEntities"_hs);
+entt::meta<ECS::DirectionalLightComponent>().func<&REF_Has<ECS::DirectionalLightComponent>, entt::as_void_t>("has"_hs);
+entt::meta<ECS::DirectionalLightComponent>().func<&REF_Remove<ECS::DirectionalLightComponent>, entt::as_void_t>("remove"_hs);
+entt::meta<ECS::DirectionalLightComponent>().func<&REF_Copy<ECS::DirectionalLightComponent>, entt::as_void_t>("copy"_hs);
+entt::meta<ECS::DirectionalLightComponent>().func<&REF_Paste<ECS::DirectionalLightComponent>, entt::as_void_t>("paste"_hs);
+entt::meta<ECS::DirectionalLightComponent>().func<&REF_MemoryStats<ECS::DirectionalLightComponent>>("memstats"_hs);
+entt::meta<ECS::DirectionalLightComponent>().func<&REF_FindBulkKernels<ECS::DirectionalLightComponent>>("bulk"_hs);
+entt::meta<ECS::DirectionalLightComponent>().func<&REF_CaptureDelta<ECS::DirectionalLightComponent>>("captureDelta"_hs);
+entt::meta<ECS::DirectionalLightComponent>().func<&REF_ApplyDeltas<ECS::DirectionalLightComponent>>("applyDeltas"_hs);
+entt::meta<ECS::DirectionalLightComponent>().func<&REF_Add<ECS::DirectionalLightComponent>, entt::as_void_t>("add"_hs);
+entt::meta<ECS::DirectionalLightComponent>().func<&REF_ValueChanged<ECS::DirectionalLightComponent>, entt::as_void_t>("add"_hs);
+}
+
+void Unregister_ECS_DirectionalLightComponent()
+{
+entt::meta<ECS::DirectionalLightComponent>().reset();
+}
+
+void Register_ECS_LightComponent()
+{
+entt::meta<ECS::LightComponent>().type().props(std::make_pair("Category"_hs,&s_reflectionStrings[29])) REF_EDITOR_PROPS(std::make_pair("Title"_hs, &s_reflectionStrings[256]), std::make_pair("Icon"_hs,ICON_FA_EYE));
 entt::meta<ECS::LightComponent>().data<&ECS::LightComponent::m_isEnabled>("m_isEnabled"_hs);
-entt::meta<ECS::LightComponent>().data<&ECS::LightComponent::m_color>("m_color"_hs).props(std::make_pair("Title"_hs,"Color"),std::make_pair("Type"_hs,"Color"),std::make_pair("Tooltip"_hs,""),std::make_pair("Depends"_hs,""_hs));
-entt::meta<ECS::LightComponent>().data<&ECS::LightComponent::m_intensity>("m_intensity"_hs).props(std::make_pair("Title"_hs,"Intensity"),std::make_pair("Type"_hs,"Float"),std::make_pair("Tooltip"_hs,""),std::make_pair("Depends"_hs,""_hs));
-entt::meta<ECS::LightComponent>().data<&ECS::LightComponent::m_drawDebug>("m_drawDebug"_hs).props(std::make_pair("Title"_hs,"Draw Debug"),std::make_pair("Type"_hs,"Bool"),std::make_pair("Tooltip"_hs,"Enables debug drawing for this component."),std::make_pair("Depends"_hs,""_hs));
-entt::meta<ECS::LightComponent>().data<&ECS::LightComponent::m_castsShadows>("m_castsShadows"_hs).props(std::make_pair("Title"_hs,"Cast Shadows"),std::make_pair("Type"_hs,"Bool"),std::make_pair("Tooltip"_hs,"Enables dynamic shadow casting for this light."),std::make_pair("Depends"_hs,""_hs));
+entt::meta<ECS::LightComponent>().data<&ECS::LightComponent::m_color>("m_color"_hs).props(std::make_pair("Type"_hs,&s_reflectionStrings[36]),std::make_pair("Depends"_hs,""_hs)) REF_EDITOR_PROPS(std::make_pair("Title"_hs,&s_reflectionStrings[36]),std::make_pair("Tooltip"_hs,&s_reflectionStrings[0]));
+entt::meta<ECS::LightComponent>().data<&ECS::LightComponent::m_intensity>("m_intensity"_hs).props(std::make_pair("Type"_hs,&s_reflectionStrings[52]),std::make_pair("Depends"_hs,""_hs)) REF_EDITOR_PROPS(std::make_pair("Title"_hs,&s_reflectionStrings[42]),std::make_pair("Tooltip"_hs,&s_reflectionStrings[0]));
+entt::meta<ECS::LightComponent>().data<&ECS::LightComponent::m_drawDebug>("m_drawDebug"_hs).props(std::make_pair("Type"_hs,&s_reflectionStrings[69]),std::make_pair("Depends"_hs,""_hs)) REF_EDITOR_PROPS(std::make_pair("Title"_hs,&s_reflectionStrings[58]),std::make_pair("Tooltip"_hs,&s_reflectionStrings[74]));
+entt::meta<ECS::LightComponent>().data<&ECS::LightComponent::m_castsShadows>("m_castsShadows"_hs).props(std::make_pair("Type"_hs,&s_reflectionStrings[69]),std::make_pair("Depends"_hs,""_hs)) REF_EDITOR_PROPS(std::make_pair("Title"_hs,&s_reflectionStrings[116]),std::make_pair("Tooltip"_hs,&s_reflectionStrings[129]));
 entt::meta<ECS::LightComponent>().func<&REF_CloneComponent<ECS::LightComponent>, entt::as_void_t>("clone"_hs);
-entt::meta<ECS::LightComponent>().func<&REF_SerializeComponent<ECS::LightComponent>, entt::as_void_t>("serialize"_hs);
-entt::meta<ECS::LightComponent>().func<&REF_DeserializeComponent<ECS::LightComponent>, entt::as_void_t>("deserialize"_hs);
+entt::meta<ECS::LightComponent>().func<&REF_SerializeComponent<ECS::LightComponent, 995979701u, 794206987u, false, &ECS::LightComponent::m_isEnabled, &ECS::LightComponent::m_color, &ECS::LightComponent::m_intensity, &ECS::LightComponent::m_drawDebug, &ECS::LightComponent::m_castsShadows>, entt::as_void_t>("serialize"_hs);
+entt::meta<ECS::LightComponent>().func<&REF_DeserializeComponent<ECS::LightComponent, 995979701u, 794206987u, false, &ECS::LightComponent::m_isEnabled, &ECS::LightComponent::m_color, &ECS::LightComponent::m_intensity, &ECS::LightComponent::m_drawDebug, &ECS::LightComponent::m_castsShadows>, entt::as_void_t>("deserialize"_hs);
+entt::meta<ECS::LightComponent>().func<&REF_DeserializeSection<ECS::LightComponent, 995979701u, 794206987u, false, &ECS::LightComponent::m_isEnabled, &ECS::LightComponent::m_color, &ECS::LightComponent::m_intensity, &ECS::LightComponent::m_drawDebug, &ECS::LightComponent::m_castsShadows>>("deserializeSection"_hs);
+entt::meta<ECS::LightComponent>().func<&REF_DeserializeLegacy<ECS::LightComponent, 995979701u, 794206987u, false, &ECS::LightComponent::m_isEnabled, &ECS::LightComponent::m_color, &ECS::LightComponent::m_intensity, &ECS::LightComponent::m_drawDebug, &ECS::LightComponent::m_castsShadows>, entt::as_void_t>("deserializeLegacy"_hs);
 entt::meta<ECS::LightComponent>().func<&REF_SetEnabled<ECS::LightComponent>, entt::as_void_t>("setEnabled"_hs);
 entt::meta<ECS::LightComponent>().func<&REF_Get<ECS::LightComponent>, entt::as_ref_t>("get"_hs);
 entt::meta<ECS::LightComponent>().func<&REF_Reset<ECS::LightComponent>, entt::as_void_t>("reset"_hs);
+entt::meta<ECS::LightComponent>().func<&REF_ResetEntities<ECS::LightComponent>, entt::as_void_t>("resetEntities"_hs);
 entt::meta<ECS::LightComponent>().func<&REF_Has<ECS::LightComponent>, entt::as_void_t>("has"_hs);
 entt::meta<ECS::LightComponent>().func<&REF_Remove<ECS::LightComponent>, entt::as_void_t>("remove"_hs);
 entt::meta<ECS::LightComponent>().func<&REF_Copy<ECS::LightComponent>, entt::as_void_t>("copy"_hs);
 entt::meta<ECS::LightComponent>().func<&REF_Paste<ECS::LightComponent>, entt::as_void_t>("paste"_hs);
+entt::meta<ECS::LightComponent>().func<&REF_MemoryStats<ECS::LightComponent>>("memstats"_hs);
+entt::meta<ECS::LightComponent>().func<&REF_FindBulkKernels<ECS::LightComponent>>("bulk"_hs);
+entt::meta<ECS::LightComponent>().func<&REF_CaptureDelta<ECS::LightComponent>>("captureDelta"_hs);
+entt::meta<ECS::LightComponent>().func<&REF_ApplyDeltas<ECS::LightComponent>>("applyDeltas"_hs);
 entt::meta<ECS::LightComponent>().func<&REF_Add<ECS::LightComponent>, entt::as_void_t>("add"_hs);
 entt::meta<ECS::LightComponent>().func<&REF_ValueChanged<ECS::LightComponent>, entt::as_void_t>("add"_hs);
-entt::meta<ECS::PointLightComponent>().type().props(std::make_pair("Title"_hs, "Point Light Component"), std::make_pair("Icon"_hs,ICON_FA_EYE), std::make_pair("Category"_hs,"Lights"));
+}
+
+void Unregister_ECS_LightComponent()
+{
+entt::meta<ECS::LightComponent>().reset();
+}
+
+void Register_ECS_PointLightComponent()
+{
+entt::meta<ECS::PointLightComponent>().type().props(std::make_pair("Category"_hs,&s_reflectionStrings[29])) REF_EDITOR_PROPS(std::make_pair("Title"_hs, &s_reflectionStrings[272]), std::make_pair("Icon"_hs,ICON_FA_EYE));
 entt::meta<ECS::PointLightComponent>().data<&ECS::PointLightComponent::m_isEnabled>("m_isEnabled"_hs);
-entt::meta<ECS::PointLightComponent>().data<&ECS::PointLightComponent::m_distance>("m_distance"_hs).props(std::make_pair("Title"_hs,"Distance"),std::make_pair("Type"_hs,"Float"),std::make_pair("Tooltip"_hs,"Light Distance"),std::make_pair("Depends"_hs,""_hs));
-entt::meta<ECS::PointLightComponent>().data<&ECS::PointLightComponent::m_bias>("m_bias"_hs).props(std::make_pair("Title"_hs,"Bias"),std::make_pair("Type"_hs,"Float"),std::make_pair("Tooltip"_hs,"Defines the shadow crispiness."),std::make_pair("Depends"_hs,""_hs));
-entt::meta<ECS::PointLightComponent>().data<&ECS::PointLightComponent::m_shadowNear>("m_shadowNear"_hs).props(std::make_pair("Title"_hs,"Shadow Near"),std::make_pair("Type"_hs,"Float"),std::make_pair("Tooltip"_hs,""),std::make_pair("Depends"_hs,""_hs));
-entt::meta<ECS::PointLightComponent>().data<&ECS::PointLightComponent::m_shadowFar>("m_shadowFar"_hs).props(std::make_pair("Title"_hs,"Shadow Far"),std::make_pair("Type"_hs,"Float"),std::make_pair("Tooltip"_hs,""),std::make_pair("Depends"_hs,""_hs));
+entt::meta<ECS::PointLightComponent>().data<&ECS::PointLightComponent::m_color>("m_color"_hs).props(std::make_pair("Type"_hs,&s_reflectionStrings[36]),std::make_pair("Depends"_hs,""_hs)) REF_EDITOR_PROPS(std::make_pair("Title"_hs,&s_reflectionStrings[36]),std::make_pair("Tooltip"_hs,&s_reflectionStrings[0]));
+entt::meta<ECS::PointLightComponent>().data<&ECS::PointLightComponent::m_intensity>("m_intensity"_hs).props(std::make_pair("Type"_hs,&s_reflectionStrings[52]),std::make_pair("Depends"_hs,""_hs)) REF_EDITOR_PROPS(std::make_pair("Title"_hs,&s_reflectionStrings[42]),std::make_pair("Tooltip"_hs,&s_reflectionStrings[0]));
+entt::meta<ECS::PointLightComponent>().data<&ECS::PointLightComponent::m_drawDebug>("m_drawDebug"_hs).props(std::make_pair("Type"_hs,&s_reflectionStrings[69]),std::make_pair("Depends"_hs,""_hs)) REF_EDITOR_PROPS(std::make_pair("Title"_hs,&s_reflectionStrings[58]),std::make_pair("Tooltip"_hs,&s_reflectionStrings[74]));
+entt::meta<ECS::PointLightComponent>().data<&ECS::PointLightComponent::m_castsShadows>("m_castsShadows"_hs).props(std::make_pair("Type"_hs,&s_reflectionStrings[69]),std::make_pair("Depends"_hs,""_hs)) REF_EDITOR_PROPS(std::make_pair("Title"_hs,&s_reflectionStrings[116]),std::make_pair("Tooltip"_hs,&s_reflectionStrings[129]));
+entt::meta<ECS::PointLightComponent>().data<&ECS::PointLightComponent::m_distance>("m_distance"_hs).props(std::make_pair("Type"_hs,&s_reflectionStrings[52]),std::make_pair("Depends"_hs,""_hs)) REF_EDITOR_PROPS(std::make_pair("Title"_hs,&s_reflectionStrings[294]),std::make_pair("Tooltip"_hs,&s_reflectionStrings[303]));
+entt::meta<ECS::PointLightComponent>().data<&ECS::PointLightComponent::m_bias>("m_bias"_hs).props(std::make_pair("Type"_hs,&s_reflectionStrings[52]),std::make_pair("Depends"_hs,""_hs)) REF_EDITOR_PROPS(std::make_pair("Title"_hs,&s_reflectionStrings[318]),std::make_pair("Tooltip"_hs,&s_reflectionStrings[323]));
+entt::meta<ECS::PointLightComponent>().data<&ECS::PointLightComponent::m_shadowNear>("m_shadowNear"_hs).props(std::make_pair("Type"_hs,&s_reflectionStrings[52]),std::make_pair("Depends"_hs,""_hs)) REF_EDITOR_PROPS(std::make_pair("Title"_hs,&s_reflectionStrings[233]),std::make_pair("Tooltip"_hs,&s_reflectionStrings[0]));
+entt::meta<ECS::PointLightComponent>().data<&ECS::PointLightComponent::m_shadowFar>("m_shadowFar"_hs).props(std::make_pair("Type"_hs,&s_reflectionStrings[52]),std::make_pair("Depends"_hs,""_hs)) REF_EDITOR_PROPS(std::make_pair("Title"_hs,&s_reflectionStrings[245]),std::make_pair("Tooltip"_hs,&s_reflectionStrings[0]));
 entt::meta<ECS::PointLightComponent>().func<&REF_CloneComponent<ECS::PointLightComponent>, entt::as_void_t>("clone"_hs);
-entt::meta<ECS::PointLightComponent>().func<&REF_SerializeComponent<ECS::PointLightComponent>, entt::as_void_t>("serialize"_hs);
-entt::meta<ECS::PointLightComponent>().func<&REF_DeserializeComponent<ECS::PointLightComponent>, entt::as_void_t>("deserialize"_hs);
+entt::meta<ECS::PointLightComponent>().func<&REF_SerializeComponent<ECS::PointLightComponent, 3232218151u, 2445915604u, false, &ECS::PointLightComponent::m_isEnabled, &ECS::PointLightComponent::m_color, &ECS::PointLightComponent::m_intensity, &ECS::PointLightComponent::m_drawDebug, &ECS::PointLightComponent::m_castsShadows, &ECS::PointLightComponent::m_distance, &ECS::PointLightComponent::m_bias, &ECS::PointLightComponent::m_shadowNear, &ECS::PointLightComponent::m_shadowFar>, entt::as_void_t>("serialize"_hs);
+entt::meta<ECS::PointLightComponent>().func<&REF_DeserializeComponent<ECS::PointLightComponent, 3232218151u, 2445915604u, false, &ECS::PointLightComponent::m_isEnabled, &ECS::PointLightComponent::m_color, &ECS::PointLightComponent::m_intensity, &ECS::PointLightComponent::m_drawDebug, &ECS::PointLightComponent::m_castsShadows, &ECS::PointLightComponent::m_distance, &ECS::PointLightComponent::m_bias, &ECS::PointLightComponent::m_shadowNear, &ECS::PointLightComponent::m_shadowFar>, entt::as_void_t>("deserialize"_hs);
+entt::meta<ECS::PointLightComponent>().func<&REF_DeserializeSection<ECS::PointLightComponent, 3232218151u, 2445915604u, false, &ECS::PointLightComponent::m_isEnabled, &ECS::PointLightComponent::m_color, &ECS::PointLightComponent::m_intensity, &ECS::PointLightComponent::m_drawDebug, &ECS::PointLightComponent::m_castsShadows, &ECS::PointLightComponent::m_distance, &ECS::PointLightComponent::m_bias, &ECS::PointLightComponent::m_shadowNear, &ECS::PointLightComponent::m_shadowFar>>("deserializeSection"_hs);
+entt::meta<ECS::PointLightComponent>().func<&REF_DeserializeLegacy<ECS::PointLightComponent, 3232218151u, 2445915604u, false, &ECS::PointLightComponent::m_isEnabled, &ECS::PointLightComponent::m_color, &ECS::PointLightComponent::m_intensity, &ECS::PointLightComponent::m_drawDebug, &ECS::PointLightComponent::m_castsShadows, &ECS::PointLightComponent::m_distance, &ECS::PointLightComponent::m_bias, &ECS::PointLightComponent::m_shadowNear, &ECS::PointLightComponent::m_shadowFar>, entt::as_void_t>("deserializeLegacy"_hs);
 entt::meta<ECS::PointLightComponent>().func<&REF_SetEnabled<ECS::PointLightComponent>, entt::as_void_t>("setEnabled"_hs);
 entt::meta<ECS::PointLightComponent>().func<&REF_Get<ECS::PointLightComponent>, entt::as_ref_t>("get"_hs);
 entt::meta<ECS::PointLightComponent>().func<&REF_Reset<ECS::PointLightComponent>, entt::as_void_t>("reset"_hs);
+entt::meta<ECS::PointLightComponent>().func<&REF_ResetEntities<ECS::PointLightComponent>, entt::as_void_t>("resetEntities"_hs);
 entt::meta<ECS::PointLightComponent>().func<&REF_Has<ECS::PointLightComponent>, entt::as_void_t>("has"_hs);
 entt::meta<ECS::PointLightComponent>().func<&REF_Remove<ECS::PointLightComponent>, entt::as_void_t>("remove"_hs);
 entt::meta<ECS::PointLightComponent>().func<&REF_Copy<ECS::PointLightComponent>, entt::as_void_t>("copy"_hs);
 entt::meta<ECS::PointLightComponent>().func<&REF_Paste<ECS::PointLightComponent>, entt::as_void_t>("paste"_hs);
+entt::meta<ECS::PointLightComponent>().func<&REF_MemoryStats<ECS::PointLightComponent>>("memstats"_hs);
+entt::meta<ECS::PointLightComponent>().func<&REF_FindBulkKernels<ECS::PointLightComponent>>("bulk"_hs);
+entt::meta<ECS::PointLightComponent>().func<&REF_CaptureDelta<ECS::PointLightComponent>>("captureDelta"_hs);
+entt::meta<ECS::PointLightComponent>().func<&REF_ApplyDeltas<ECS::PointLightComponent>>("applyDeltas"_hs);
 entt::meta<ECS::PointLightComponent>().func<&REF_Add<ECS::PointLightComponent>, entt::as_void_t>("add"_hs);
 entt::meta<ECS::PointLightComponent>().func<&REF_ValueChanged<ECS::PointLightComponent>, entt::as_void_t>("add"_hs);
-entt::meta<ECS::DirectionalLightComponent>().type().props(std::make_pair("Title"_hs, "Directional Light Component"), std::make_pair("Icon"_hs,ICON_FA_EYE), std::make_pair("Category"_hs,"Lights"));
-entt::meta<ECS::DirectionalLightComponent>().data<&ECS::DirectionalLightComponent::m_isEnabled>("m_isEnabled"_hs);
-entt::meta<ECS::DirectionalLightComponent>().data<&ECS::DirectionalLightComponent::m_shadowOrthoProjection>("m_shadowOrthoProjection"_hs).props(std::make_pair("Title"_hs,"Projection"),std::make_pair("Type"_hs,"Vector4"),std::make_pair("Tooltip"_hs,"Defines shadow projection boundaries."),std::make_pair("Depends"_hs,""_hs));
-entt::meta<ECS::DirectionalLightComponent>().data<&ECS::DirectionalLightComponent::m_shadowZNear>("m_shadowZNear"_hs).props(std::make_pair("Title"_hs,"Shadow Near"),std::make_pair("Type"_hs,"Float"),std::make_pair("Tooltip"_hs,""),std::make_pair("Depends"_hs,""_hs));
-entt::meta<ECS::DirectionalLightComponent>().data<&ECS::DirectionalLightComponent::m_shadowZFar>("m_shadowZFar"_hs).props(std::make_pair("Title"_hs,"Shadow Far"),std::make_pair("Type"_hs,"Float"),std::make_pair("Tooltip"_hs,""),std::make_pair("Depends"_hs,""_hs));
-entt::meta<ECS::DirectionalLightComponent>().func<&REF_CloneComponent<ECS::DirectionalLightComponent>, entt::as_void_t>("clone"_hs);
-entt::meta<ECS::DirectionalLightComponent>().func<&REF_SerializeComponent<ECS::DirectionalLightComponent>, entt::as_void_t>("serialize"_hs);
-entt::meta<ECS::DirectionalLightComponent>().func<&REF_DeserializeComponent<ECS::DirectionalLightComponent>, entt::as_void_t>("deserialize"_hs);
-entt::meta<ECS::DirectionalLightComponent>().func<&REF_SetEnabled<ECS::DirectionalLightComponent>, entt::as_void_t>("setEnabled"_hs);
-entt::meta<ECS::DirectionalLightComponent>().func<&REF_Get<ECS::DirectionalLightComponent>, entt::as_ref_t>("get"_hs);
-entt::meta<ECS::DirectionalLightComponent>().func<&REF_Reset<ECS::DirectionalLightComponent>, entt::as_void_t>("reset"_hs);
-entt::meta<ECS::DirectionalLightComponent>().func<&REF_Has<ECS::DirectionalLightComponent>, entt::as_void_t>("has"_hs);
-entt::meta<ECS::DirectionalLightComponent>().func<&REF_Remove<ECS::DirectionalLightComponent>, entt::as_void_t>("remove"_hs);
-entt::meta<ECS::DirectionalLightComponent>().func<&REF_Copy<ECS::DirectionalLightComponent>, entt::as_void_t>("copy"_hs);
-entt::meta<ECS::DirectionalLightComponent>().func<&REF_Paste<ECS::DirectionalLightComponent>, entt::as_void_t>("paste"_hs);
-entt::meta<ECS::DirectionalLightComponent>().func<&REF_Add<ECS::DirectionalLightComponent>, entt::as_void_t>("add"_hs);
-entt::meta<ECS::DirectionalLightComponent>().func<&REF_ValueChanged<ECS::DirectionalLightComponent>, entt::as_void_t>("add"_hs);
-entt::meta<ECS::EntityDataComponent>().type().props("Title"_hs, "Entity Data Component");
+}
+
+void Unregister_ECS_PointLightComponent()
+{
+entt::meta<ECS::PointLightComponent>().reset();
+}
+
+void Register_ECS_SpotLightComponent()
+{
+entt::meta<ECS::SpotLightComponent>().type().props(std::make_pair("Category"_hs,&s_reflectionStrings[29])) REF_EDITOR_PROPS(std::make_pair("Title"_hs, &s_reflectionStrings[354]), std::make_pair("Icon"_hs,ICON_FA_EYE));
+entt::meta<ECS::SpotLightComponent>().data<&ECS::SpotLightComponent::m_isEnabled>("m_isEnabled"_hs);
+entt::meta<ECS::SpotLightComponent>().data<&ECS::SpotLightComponent::m_color>("m_color"_hs).props(std::make_pair("Type"_hs,&s_reflectionStrings[36]),std::make_pair("Depends"_hs,""_hs)) REF_EDITOR_PROPS(std::make_pair("Title"_hs,&s_reflectionStrings[36]),std::make_pair("Tooltip"_hs,&s_reflectionStrings[0]));
+entt::meta<ECS::SpotLightComponent>().data<&ECS::SpotLightComponent::m_intensity>("m_intensity"_hs).props(std::make_pair("Type"_hs,&s_reflectionStrings[52]),std::make_pair("Depends"_hs,""_hs)) REF_EDITOR_PROPS(std::make_pair("Title"_hs,&s_reflectionStrings[42]),std::make_pair("Tooltip"_hs,&s_reflectionStrings[0]));
+entt::meta<ECS::SpotLightComponent>().data<&ECS::SpotLightComponent::m_drawDebug>("m_drawDebug"_hs).props(std::make_pair("Type"_hs,&s_reflectionStrings[69]),std::make_pair("Depends"_hs,""_hs)) REF_EDITOR_PROPS(std::make_pair("Title"_hs,&s_reflectionStrings[58]),std::make_pair("Tooltip"_hs,&s_reflectionStrings[74]));
+entt::meta<ECS::SpotLightComponent>().data<&ECS::SpotLightComponent::m_castsShadows>("m_castsShadows"_hs).props(std::make_pair("Type"_hs,&s_reflectionStrings[69]),std::make_pair("Depends"_hs,""_hs)) REF_EDITOR_PROPS(std::make_pair("Title"_hs,&s_reflectionStrings[116]),std::make_pair("Tooltip"_hs,&s_reflectionStrings[129]));
+entt::meta<ECS::SpotLightComponent>().data<&ECS::SpotLightComponent::m_distance>("m_distance"_hs).props(std::make_pair("Type"_hs,&s_reflectionStrings[52]),std::make_pair("Depends"_hs,""_hs)) REF_EDITOR_PROPS(std::make_pair("Title"_hs,&s_reflectionStrings[294]),std::make_pair("Tooltip"_hs,&s_reflectionStrings[303]));
+entt::meta<ECS::SpotLightComponent>().data<&ECS::SpotLightComponent::m_cutoff>("m_cutoff"_hs).props(std::make_pair("Type"_hs,&s_reflectionStrings[52]),std::make_pair("Depends"_hs,""_hs)) REF_EDITOR_PROPS(std::make_pair("Title"_hs,&s_reflectionStrings[375]),std::make_pair("Tooltip"_hs,&s_reflectionStrings[382]));
+entt::meta<ECS::SpotLightComponent>().data<&ECS::SpotLightComponent::m_outerCutoff>("m_outerCutoff"_hs).props(std::make_pair("Type"_hs,&s_reflectionStrings[52]),std::make_pair("Depends"_hs,""_hs)) REF_EDITOR_PROPS(std::make_pair("Title"_hs,&s_reflectionStrings[502]),std::make_pair("Tooltip"_hs,&s_reflectionStrings[382]));
+entt::meta<ECS::SpotLightComponent>().func<&REF_CloneComponent<ECS::SpotLightComponent>, entt::as_void_t>("clone"_hs);
+entt::meta<ECS::SpotLightComponent>().func<&REF_SerializeComponent<ECS::SpotLightComponent, 1356326053u, 124682263u, true, &ECS::SpotLightComponent::m_isEnabled, &ECS::SpotLightComponent::m_color, &ECS::SpotLightComponent::m_intensity, &ECS::SpotLightComponent::m_drawDebug, &ECS::SpotLightComponent::m_castsShadows, &ECS::SpotLightComponent::m_distance>, entt::as_void_t>("serialize"_hs);
+entt::meta<ECS::SpotLightComponent>().func<&REF_DeserializeComponent<ECS::SpotLightComponent, 1356326053u, 124682263u, true, &ECS::SpotLightComponent::m_isEnabled, &ECS::SpotLightComponent::m_color, &ECS::SpotLightComponent::m_intensity, &ECS::SpotLightComponent::m_drawDebug, &ECS::SpotLightComponent::m_castsShadows, &ECS::SpotLightComponent::m_distance>, entt::as_void_t>("deserialize"_hs);
+entt::meta<ECS::SpotLightComponent>().func<&REF_DeserializeSection<ECS::SpotLightComponent, 1356326053u, 124682263u, true, &ECS::SpotLightComponent::m_isEnabled, &ECS::SpotLightComponent::m_color, &ECS::SpotLightComponent::m_intensity, &ECS::SpotLightComponent::m_drawDebug, &ECS::SpotLightComponent::m_castsShadows, &ECS::SpotLightComponent::m_distance>>("deserializeSection"_hs);
+entt::meta<ECS::SpotLightComponent>().func<&REF_DeserializeLegacy<ECS::SpotLightComponent, 1356326053u, 124682263u, true, &ECS::SpotLightComponent::m_isEnabled, &ECS::SpotLightComponent::m_color, &ECS::SpotLightComponent::m_intensity, &ECS::SpotLightComponent::m_drawDebug, &ECS::SpotLightComponent::m_castsShadows, &ECS::SpotLightComponent::m_distance>, entt::as_void_t>("deserializeLegacy"_hs);
+entt::meta<ECS::SpotLightComponent>().func<&REF_SetEnabled<ECS::SpotLightComponent>, entt::as_void_t>("setEnabled"_hs);
+entt::meta<ECS::SpotLightComponent>().func<&REF_Get<ECS::SpotLightComponent>, entt::as_ref_t>("get"_hs);
+entt::meta<ECS::SpotLightComponent>().func<&REF_Reset<ECS::SpotLightComponent>, entt::as_void_t>("reset"_hs);
+entt::meta<ECS::SpotLightComponent>().func<&REF_ResetEntities<ECS::SpotLightComponent>, entt::as_void_t>("resetEntities"_hs);
+entt::meta<ECS::SpotLightComponent>().func<&REF_Has<ECS::SpotLightComponent>, entt::as_void_t>("has"_hs);
+entt::meta<ECS::SpotLightComponent>().func<&REF_Remove<ECS::SpotLightComponent>, entt::as_void_t>("remove"_hs);
+entt::meta<ECS::SpotLightComponent>().func<&REF_Copy<ECS::SpotLightComponent>, entt::as_void_t>("copy"_hs);
+entt::meta<ECS::SpotLightComponent>().func<&REF_Paste<ECS::SpotLightComponent>, entt::as_void_t>("paste"_hs);
+entt::meta<ECS::SpotLightComponent>().func<&REF_MemoryStats<ECS::SpotLightComponent>>("memstats"_hs);
+entt::meta<ECS::SpotLightComponent>().func<&REF_FindBulkKernels<ECS::SpotLightComponent>>("bulk"_hs);
+entt::meta<ECS::SpotLightComponent>().func<&REF_CaptureDelta<ECS::SpotLightComponent>>("captureDelta"_hs);
+entt::meta<ECS::SpotLightComponent>().func<&REF_ApplyDeltas<ECS::SpotLightComponent>>("applyDeltas"_hs);
+entt::meta<ECS::SpotLightComponent>().func<&REF_Add<ECS::SpotLightComponent>, entt::as_void_t>("add"_hs);
+entt::meta<ECS::SpotLightComponent>().func<&REF_ValueChanged<ECS::SpotLightComponent>, entt::as_void_t>("add"_hs);
+}
+
+void Unregister_ECS_SpotLightComponent()
+{
+entt::meta<ECS::SpotLightComponent>().reset();
+}
+
+void Register_ECS_EntityDataComponent()
+{
+entt::meta<ECS::EntityDataComponent>().type() REF_EDITOR_PROPS("Title"_hs, &s_reflectionStrings[515]);
+entt::meta<ECS::EntityDataComponent>().func<&REF_MemoryStats<ECS::EntityDataComponent>>("memstats"_hs);
+}
+
+void Unregister_ECS_EntityDataComponent()
+{
+entt::meta<ECS::EntityDataComponent>().reset();
+}
+
+static ReflectedTypeEntry s_reflectedTypes[] = {
+{995979701u, "ECS::LightComponent", "Depth1/Depth2/Test2.hpp", &Register_ECS_LightComponent, &Unregister_ECS_LightComponent},
+{1356326053u, "ECS::SpotLightComponent", "Depth1/Depth2/Test2.hpp", &Register_ECS_SpotLightComponent, &Unregister_ECS_SpotLightComponent},
+{3048757949u, "ECS::DirectionalLightComponent", "Depth1/Depth2/Test2.hpp", &Register_ECS_DirectionalLightComponent, &Unregister_ECS_DirectionalLightComponent},
+{3198549676u, "ECS::EntityDataComponent", "Depth1/Depth2/Test.hpp", &Register_ECS_EntityDataComponent, &Unregister_ECS_EntityDataComponent},
+{3232218151u, "ECS::PointLightComponent", "Depth1/Depth2/Test2.hpp", &Register_ECS_PointLightComponent, &Unregister_ECS_PointLightComponent},
+};
+
+ReflectedTypeEntry* GetReflectedTypes(uint32_t& count)
+{
+count = static_cast<uint32_t>(sizeof(s_reflectedTypes) / sizeof(s_reflectedTypes[0]));
+return s_reflectedTypes;
+}
+} // namespace LinaEngineReflection
+
+template <>
+void EnsureRegistered<ECS::LightComponent>()
+{
+EnsureRegistered(LinaEngineReflection::s_reflectedTypes[0]);
+}
+
+template <>
+void EnsureRegistered<ECS::SpotLightComponent>()
+{
+EnsureRegistered(LinaEngineReflection::s_reflectedTypes[1]);
+}
+
+template <>
+void EnsureRegistered<ECS::DirectionalLightComponent>()
+{
+EnsureRegistered(LinaEngineReflection::s_reflectedTypes[2]);
+}
+
+template <>
+void EnsureRegistered<ECS::EntityDataComponent>()
+{
+EnsureRegistered(LinaEngineReflection::s_reflectedTypes[3]);
+}
+
+template <>
+void EnsureRegistered<ECS::PointLightComponent>()
+{
+EnsureRegistered(LinaEngineReflection::s_reflectedTypes[4]);
+}
+
+template <>
+const ReflectedProperty* GetReflectedProperties<ECS::LightComponent>(uint32_t& count)
+{
+static const std::vector<ReflectedProperty> properties = REF_SortProperties({
+REF_Property<ECS::LightComponent>("m_isEnabled"_hs, &ECS::LightComponent::m_isEnabled),
+REF_Property<ECS::LightComponent>("m_color"_hs, &ECS::LightComponent::m_color),
+REF_Property<ECS::LightComponent>("m_intensity"_hs, &ECS::LightComponent::m_intensity),
+REF_Property<ECS::LightComponent>("m_drawDebug"_hs, &ECS::LightComponent::m_drawDebug),
+REF_Property<ECS::LightComponent>("m_castsShadows"_hs, &ECS::LightComponent::m_castsShadows),
+});
+count = static_cast<uint32_t>(properties.size());
+return properties.data();
+}
+
+template <>
+const ReflectedProperty* GetReflectedProperties<ECS::SpotLightComponent>(uint32_t& count)
+{
+static const std::vector<ReflectedProperty> properties = REF_SortProperties({
+REF_Property<ECS::SpotLightComponent>("m_isEnabled"_hs, &ECS::SpotLightComponent::m_isEnabled),
+REF_Property<ECS::SpotLightComponent>("m_color"_hs, &ECS::SpotLightComponent::m_color),
+REF_Property<ECS::SpotLightComponent>("m_intensity"_hs, &ECS::SpotLightComponent::m_intensity),
+REF_Property<ECS::SpotLightComponent>("m_drawDebug"_hs, &ECS::SpotLightComponent::m_drawDebug),
+REF_Property<ECS::SpotLightComponent>("m_castsShadows"_hs, &ECS::SpotLightComponent::m_castsShadows),
+REF_Property<ECS::SpotLightComponent>("m_distance"_hs, &ECS::SpotLightComponent::m_distance),
+REF_Property<ECS::SpotLightComponent>("m_cutoff"_hs, &ECS::SpotLightComponent::m_cutoff),
+REF_Property<ECS::SpotLightComponent>("m_outerCutoff"_hs, &ECS::SpotLightComponent::m_outerCutoff),
+});
+count = static_cast<uint32_t>(properties.size());
+return properties.data();
+}
+
+template <>
+const ReflectedProperty* GetReflectedProperties<ECS::DirectionalLightComponent>(uint32_t& count)
+{
+static const std::vector<ReflectedProperty> properties = REF_SortProperties({
+REF_Property<ECS::DirectionalLightComponent>("m_isEnabled"_hs, &ECS::DirectionalLightComponent::m_isEnabled),
+REF_Property<ECS::DirectionalLightComponent>("m_color"_hs, &ECS::DirectionalLightComponent::m_color),
+REF_Property<ECS::DirectionalLightComponent>("m_intensity"_hs, &ECS::DirectionalLightComponent::m_intensity),
+REF_Property<ECS::DirectionalLightComponent>("m_drawDebug"_hs, &ECS::DirectionalLightComponent::m_drawDebug),
+REF_Property<ECS::DirectionalLightComponent>("m_castsShadows"_hs, &ECS::DirectionalLightComponent::m_castsShadows),
+REF_Property<ECS::DirectionalLightComponent>("m_shadowOrthoProjection"_hs, &ECS::DirectionalLightComponent::m_shadowOrthoProjection),
+REF_Property<ECS::DirectionalLightComponent>("m_shadowZNear"_hs, &ECS::DirectionalLightComponent::m_shadowZNear),
+REF_Property<ECS::DirectionalLightComponent>("m_shadowZFar"_hs, &ECS::DirectionalLightComponent::m_shadowZFar),
+});
+count = static_cast<uint32_t>(properties.size());
+return properties.data();
+}
+
+template <>
+const ReflectedProperty* GetReflectedProperties<ECS::EntityDataComponent>(uint32_t& count)
+{
+static const std::vector<ReflectedProperty> properties = REF_SortProperties({
+});
+count = static_cast<uint32_t>(properties.size());
+return properties.data();
+}
+
+template <>
+const ReflectedProperty* GetReflectedProperties<ECS::PointLightComponent>(uint32_t& count)
+{
+static const std::vector<ReflectedProperty> properties = REF_SortProperties({
+REF_Property<ECS::PointLightComponent>("m_isEnabled"_hs, &ECS::PointLightComponent::m_isEnabled),
+REF_Property<ECS::PointLightComponent>("m_color"_hs, &ECS::PointLightComponent::m_color),
+REF_Property<ECS::PointLightComponent>("m_intensity"_hs, &ECS::PointLightComponent::m_intensity),
+REF_Property<ECS::PointLightComponent>("m_drawDebug"_hs, &ECS::PointLightComponent::m_drawDebug),
+REF_Property<ECS::PointLightComponent>("m_castsShadows"_hs, &ECS::PointLightComponent::m_castsShadows),
+REF_Property<ECS::PointLightComponent>("m_distance"_hs, &ECS::PointLightComponent::m_distance),
+REF_Property<ECS::PointLightComponent>("m_bias"_hs, &ECS::PointLightComponent::m_bias),
+REF_Property<ECS::PointLightComponent>("m_shadowNear"_hs, &ECS::PointLightComponent::m_shadowNear),
+REF_Property<ECS::PointLightComponent>("m_shadowFar"_hs, &ECS::PointLightComponent::m_shadowFar),
+});
+count = static_cast<uint32_t>(properties.size());
+return properties.data();
+}
+
+template <>
+const ReflectedBulkKernels* GetReflectedBulkKernels<ECS::DirectionalLightComponent>(uint32_t& count)
+{
+static constexpr ReflectedBulkKernels kernels[] = {
+REF_BulkKernels<ECS::DirectionalLightComponent, &ECS::DirectionalLightComponent::m_intensity>("m_intensity"_hs),
+REF_BulkKernels<ECS::DirectionalLightComponent, &ECS::DirectionalLightComponent::m_shadowZNear>("m_shadowZNear"_hs),
+REF_BulkKernels<ECS::DirectionalLightComponent, &ECS::DirectionalLightComponent::m_shadowZFar>("m_shadowZFar"_hs),
+};
+count = static_cast<uint32_t>(sizeof(kernels) / sizeof(kernels[0]));
+return kernels;
+}
+
+template <>
+const ReflectedDeltaCodec* GetReflectedDeltaCodec<ECS::DirectionalLightComponent>()
+{
+static constexpr ReflectedDeltaCodec codec = REF_DeltaCodec<ECS::DirectionalLightComponent, &ECS::DirectionalLightComponent::m_isEnabled, &ECS::DirectionalLightComponent::m_color, &ECS::DirectionalLightComponent::m_intensity, &ECS::DirectionalLightComponent::m_drawDebug, &ECS::DirectionalLightComponent::m_castsShadows, &ECS::DirectionalLightComponent::m_shadowOrthoProjection, &ECS::DirectionalLightComponent::m_shadowZNear, &ECS::DirectionalLightComponent::m_shadowZFar>();
+return &codec;
+}
+
+template <>
+const ReflectedQuantizedField* GetReflectedQuantizedFields<ECS::DirectionalLightComponent>(uint32_t& count)
+{
+count = 0;
+return nullptr;
+}
+
+template <>
+const ReflectedBulkKernels* GetReflectedBulkKernels<ECS::LightComponent>(uint32_t& count)
+{
+static constexpr ReflectedBulkKernels kernels[] = {
+REF_BulkKernels<ECS::LightComponent, &ECS::LightComponent::m_intensity>("m_intensity"_hs),
+};
+count = static_cast<uint32_t>(sizeof(kernels) / sizeof(kernels[0]));
+return kernels;
+}
+
+template <>
+const ReflectedDeltaCodec* GetReflectedDeltaCodec<ECS::LightComponent>()
+{
+static constexpr ReflectedDeltaCodec codec = REF_DeltaCodec<ECS::LightComponent, &ECS::LightComponent::m_isEnabled, &ECS::LightComponent::m_color, &ECS::LightComponent::m_intensity, &ECS::LightComponent::m_drawDebug, &ECS::LightComponent::m_castsShadows>();
+return &codec;
+}
+
+template <>
+const ReflectedQuantizedField* GetReflectedQuantizedFields<ECS::LightComponent>(uint32_t& count)
+{
+count = 0;
+return nullptr;
+}
+
+template <>
+const ReflectedBulkKernels* GetReflectedBulkKernels<ECS::PointLightComponent>(uint32_t& count)
+{
+static constexpr ReflectedBulkKernels kernels[] = {
+REF_BulkKernels<ECS::PointLightComponent, &ECS::PointLightComponent::m_intensity>("m_intensity"_hs),
+REF_BulkKernels<ECS::PointLightComponent, &ECS::PointLightComponent::m_distance>("m_distance"_hs),
+REF_BulkKernels<ECS::PointLightComponent, &ECS::PointLightComponent::m_bias>("m_bias"_hs),
+REF_BulkKernels<ECS::PointLightComponent, &ECS::PointLightComponent::m_shadowNear>("m_shadowNear"_hs),
+REF_BulkKernels<ECS::PointLightComponent, &ECS::PointLightComponent::m_shadowFar>("m_shadowFar"_hs),
+};
+count = static_cast<uint32_t>(sizeof(kernels) / sizeof(kernels[0]));
+return kernels;
+}
+
+template <>
+const ReflectedDeltaCodec* GetReflectedDeltaCodec<ECS::PointLightComponent>()
+{
+static constexpr ReflectedDeltaCodec codec = REF_DeltaCodec<ECS::PointLightComponent, &ECS::PointLightComponent::m_isEnabled, &ECS::PointLightComponent::m_color, &ECS::PointLightComponent::m_intensity, &ECS::PointLightComponent::m_drawDebug, &ECS::PointLightComponent::m_castsShadows, &ECS::PointLightComponent::m_distance, &ECS::PointLightComponent::m_bias, &ECS::PointLightComponent::m_shadowNear, &ECS::PointLightComponent::m_shadowFar>();
+return &codec;
+}
+
+template <>
+const ReflectedQuantizedField* GetReflectedQuantizedFields<ECS::PointLightComponent>(uint32_t& count)
+{
+count = 0;
+return nullptr;
+}
+
+template <>
+const ReflectedBulkKernels* GetReflectedBulkKernels<ECS::SpotLightComponent>(uint32_t& count)
+{
+static constexpr ReflectedBulkKernels kernels[] = {
+REF_BulkKernels<ECS::SpotLightComponent, &ECS::SpotLightComponent::m_intensity>("m_intensity"_hs),
+REF_BulkKernels<ECS::SpotLightComponent, &ECS::SpotLightComponent::m_distance>("m_distance"_hs),
+REF_BulkKernels<ECS::SpotLightComponent, &ECS::SpotLightComponent::m_cutoff>("m_cutoff"_hs),
+REF_BulkKernels<ECS::SpotLightComponent, &ECS::SpotLightComponent::m_outerCutoff>("m_outerCutoff"_hs),
+};
+count = static_cast<uint32_t>(sizeof(kernels) / sizeof(kernels[0]));
+return kernels;
+}
+
+template <>
+const ReflectedDeltaCodec* GetReflectedDeltaCodec<ECS::SpotLightComponent>()
+{
+static constexpr ReflectedDeltaCodec codec = REF_DeltaCodec<ECS::SpotLightComponent, &ECS::SpotLightComponent::m_isEnabled, &ECS::SpotLightComponent::m_color, &ECS::SpotLightComponent::m_intensity, &ECS::SpotLightComponent::m_drawDebug, &ECS::SpotLightComponent::m_castsShadows, &ECS::SpotLightComponent::m_distance, &ECS::SpotLightComponent::m_cutoff, &ECS::SpotLightComponent::m_outerCutoff>();
+return &codec;
+}
+
+template <>
+const ReflectedQuantizedField* GetReflectedQuantizedFields<ECS::SpotLightComponent>(uint32_t& count)
+{
+static constexpr ReflectedQuantizedField fields[] = {
+REF_QuantizedField<ECS::SpotLightComponent, &ECS::SpotLightComponent::m_cutoff>("m_cutoff"_hs, 0.0, 1.0, 13u),
+REF_QuantizedField<ECS::SpotLightComponent, &ECS::SpotLightComponent::m_outerCutoff>("m_outerCutoff"_hs, 0.0, 1.0, 13u),
+};
+count = static_cast<uint32_t>(sizeof(fields) / sizeof(fields[0]));
+return fields;
+}
+
+namespace LinaEngineReflection
+{
+constexpr ReflectedComponentFunctions g_reflectedComponentFunctions[REFLECTED_COMPONENT_COUNT] = {
+{&REF_CloneComponent<ECS::DirectionalLightComponent>, &REF_SerializeComponent<ECS::DirectionalLightComponent, 3048757949u, 2157534642u, false, &ECS::DirectionalLightComponent::m_isEnabled, &ECS::DirectionalLightComponent::m_color, &ECS::DirectionalLightComponent::m_intensity, &ECS::DirectionalLightComponent::m_drawDebug, &ECS::DirectionalLightComponent::m_castsShadows, &ECS::DirectionalLightComponent::m_shadowOrthoProjection, &ECS::DirectionalLightComponent::m_shadowZNear, &ECS::DirectionalLightComponent::m_shadowZFar>, &REF_DeserializeComponent<ECS::DirectionalLightComponent, 3048757949u, 2157534642u, false, &ECS::DirectionalLightComponent::m_isEnabled, &ECS::DirectionalLightComponent::m_color, &ECS::DirectionalLightComponent::m_intensity, &ECS::DirectionalLightComponent::m_drawDebug, &ECS::DirectionalLightComponent::m_castsShadows, &ECS::DirectionalLightComponent::m_shadowOrthoProjection, &ECS::DirectionalLightComponent::m_shadowZNear, &ECS::DirectionalLightComponent::m_shadowZFar>, &REF_DeserializeSection<ECS::DirectionalLightComponent, 3048757949u, 2157534642u, false, &ECS::DirectionalLightComponent::m_isEnabled, &ECS::DirectionalLightComponent::m_color, &ECS::DirectionalLightComponent::m_intensity, &ECS::DirectionalLightComponent::m_drawDebug, &ECS::DirectionalLightComponent::m_castsShadows, &ECS::DirectionalLightComponent::m_shadowOrthoProjection, &ECS::DirectionalLightComponent::m_shadowZNear, &ECS::DirectionalLightComponent::m_shadowZFar>, &REF_DeserializeLegacy<ECS::DirectionalLightComponent, 3048757949u, 2157534642u, false, &ECS::DirectionalLightComponent::m_isEnabled, &ECS::DirectionalLightComponent::m_color, &ECS::DirectionalLightComponent::m_intensity, &ECS::DirectionalLightComponent::m_drawDebug, &ECS::DirectionalLightComponent::m_castsShadows, &ECS::DirectionalLightComponent::m_shadowOrthoProjection, &ECS::DirectionalLightComponent::m_shadowZNear, &ECS::DirectionalLightComponent::m_shadowZFar>, &REF_SetEnabled<ECS::DirectionalLightComponent>, &REF_Reset<ECS::DirectionalLightComponent>, &REF_ResetEntities<ECS::DirectionalLightComponent>, &REF_Has<ECS::DirectionalLightComponent>, &REF_Remove<ECS::DirectionalLightComponent>, &GetReflectedProperties<ECS::DirectionalLightComponent>, &REF_FindBulkKernels<ECS::DirectionalLightComponent>, &GetReflectedDeltaCodec<ECS::DirectionalLightComponent>, &REF_CaptureDelta<ECS::DirectionalLightComponent>, &REF_ApplyDeltas<ECS::DirectionalLightComponent>, &GetReflectedQuantizedFields<ECS::DirectionalLightComponent>, &REF_MemoryStats<ECS::DirectionalLightComponent>, &REF_Add<ECS::DirectionalLightComponent>},
+{&REF_CloneComponent<ECS::LightComponent>, &REF_SerializeComponent<ECS::LightComponent, 995979701u, 794206987u, false, &ECS::LightComponent::m_isEnabled, &ECS::LightComponent::m_color, &ECS::LightComponent::m_intensity, &ECS::LightComponent::m_drawDebug, &ECS::LightComponent::m_castsShadows>, &REF_DeserializeComponent<ECS::LightComponent, 995979701u, 794206987u, false, &ECS::LightComponent::m_isEnabled, &ECS::LightComponent::m_color, &ECS::LightComponent::m_intensity, &ECS::LightComponent::m_drawDebug, &ECS::LightComponent::m_castsShadows>, &REF_DeserializeSection<ECS::LightComponent, 995979701u, 794206987u, false, &ECS::LightComponent::m_isEnabled, &ECS::LightComponent::m_color, &ECS::LightComponent::m_intensity, &ECS::LightComponent::m_drawDebug, &ECS::LightComponent::m_castsShadows>, &REF_DeserializeLegacy<ECS::LightComponent, 995979701u, 794206987u, false, &ECS::LightComponent::m_isEnabled, &ECS::LightComponent::m_color, &ECS::LightComponent::m_intensity, &ECS::LightComponent::m_drawDebug, &ECS::LightComponent::m_castsShadows>, &REF_SetEnabled<ECS::LightComponent>, &REF_Reset<ECS::LightComponent>, &REF_ResetEntities<ECS::LightComponent>, &REF_Has<ECS::LightComponent>, &REF_Remove<ECS::LightComponent>, &GetReflectedProperties<ECS::LightComponent>, &REF_FindBulkKernels<ECS::LightComponent>, &GetReflectedDeltaCodec<ECS::LightComponent>, &REF_CaptureDelta<ECS::LightComponent>, &REF_ApplyDeltas<ECS::LightComponent>, &GetReflectedQuantizedFields<ECS::LightComponent>, &REF_MemoryStats<ECS::LightComponent>, &REF_Add<ECS::LightComponent>},
+{&REF_CloneComponent<ECS::PointLightComponent>, &REF_SerializeComponent<ECS::PointLightComponent, 3232218151u, 2445915604u, false, &ECS::PointLightComponent::m_isEnabled, &ECS::PointLightComponent::m_color, &ECS::PointLightComponent::m_intensity, &ECS::PointLightComponent::m_drawDebug, &ECS::PointLightComponent::m_castsShadows, &ECS::PointLightComponent::m_distance, &ECS::PointLightComponent::m_bias, &ECS::PointLightComponent::m_shadowNear, &ECS::PointLightComponent::m_shadowFar>, &REF_DeserializeComponent<ECS::PointLightComponent, 3232218151u, 2445915604u, false, &ECS::PointLightComponent::m_isEnabled, &ECS::PointLightComponent::m_color, &ECS::PointLightComponent::m_intensity, &ECS::PointLightComponent::m_drawDebug, &ECS::PointLightComponent::m_castsShadows, &ECS::PointLightComponent::m_distance, &ECS::PointLightComponent::m_bias, &ECS::PointLightComponent::m_shadowNear, &ECS::PointLightComponent::m_shadowFar>, &REF_DeserializeSection<ECS::PointLightComponent, 3232218151u, 2445915604u, false, &ECS::PointLightComponent::m_isEnabled, &ECS::PointLightComponent::m_color, &ECS::PointLightComponent::m_intensity, &ECS::PointLightComponent::m_drawDebug, &ECS::PointLightComponent::m_castsShadows, &ECS::PointLightComponent::m_distance, &ECS::PointLightComponent::m_bias, &ECS::PointLightComponent::m_shadowNear, &ECS::PointLightComponent::m_shadowFar>, &REF_DeserializeLegacy<ECS::PointLightComponent, 3232218151u, 2445915604u, false, &ECS::PointLightComponent::m_isEnabled, &ECS::PointLightComponent::m_color, &ECS::PointLightComponent::m_intensity, &ECS::PointLightComponent::m_drawDebug, &ECS::PointLightComponent::m_castsShadows, &ECS::PointLightComponent::m_distance, &ECS::PointLightComponent::m_bias, &ECS::PointLightComponent::m_shadowNear, &ECS::PointLightComponent::m_shadowFar>, &REF_SetEnabled<ECS::PointLightComponent>, &REF_Reset<ECS::PointLightComponent>, &REF_ResetEntities<ECS::PointLightComponent>, &REF_Has<ECS::PointLightComponent>, &REF_Remove<ECS::PointLightComponent>, &GetReflectedProperties<ECS::PointLightComponent>, &REF_FindBulkKernels<ECS::PointLightComponent>, &GetReflectedDeltaCodec<ECS::PointLightComponent>, &REF_CaptureDelta<ECS::PointLightComponent>, &REF_ApplyDeltas<ECS::PointLightComponent>, &GetReflectedQuantizedFields<ECS::PointLightComponent>, &REF_MemoryStats<ECS::PointLightComponent>, &REF_Add<ECS::PointLightComponent>},
+{&REF_CloneComponent<ECS::SpotLightComponent>, &REF_SerializeComponent<ECS::SpotLightComponent, 1356326053u, 124682263u, true, &ECS::SpotLightComponent::m_isEnabled, &ECS::SpotLightComponent::m_color, &ECS::SpotLightComponent::m_intensity, &ECS::SpotLightComponent::m_drawDebug, &ECS::SpotLightComponent::m_castsShadows, &ECS::SpotLightComponent::m_distance>, &REF_DeserializeComponent<ECS::SpotLightComponent, 1356326053u, 124682263u, true, &ECS::SpotLightComponent::m_isEnabled, &ECS::SpotLightComponent::m_color, &ECS::SpotLightComponent::m_intensity, &ECS::SpotLightComponent::m_drawDebug, &ECS::SpotLightComponent::m_castsShadows, &ECS::SpotLightComponent::m_distance>, &REF_DeserializeSection<ECS::SpotLightComponent, 1356326053u, 124682263u, true, &ECS::SpotLightComponent::m_isEnabled, &ECS::SpotLightComponent::m_color, &ECS::SpotLightComponent::m_intensity, &ECS::SpotLightComponent::m_drawDebug, &ECS::SpotLightComponent::m_castsShadows, &ECS::SpotLightComponent::m_distance>, &REF_DeserializeLegacy<ECS::SpotLightComponent, 1356326053u, 124682263u, true, &ECS::SpotLightComponent::m_isEnabled, &ECS::SpotLightComponent::m_color, &ECS::SpotLightComponent::m_intensity, &ECS::SpotLightComponent::m_drawDebug, &ECS::SpotLightComponent::m_castsShadows, &ECS::SpotLightComponent::m_distance>, &REF_SetEnabled<ECS::SpotLightComponent>, &REF_Reset<ECS::SpotLightComponent>, &REF_ResetEntities<ECS::SpotLightComponent>, &REF_Has<ECS::SpotLightComponent>, &REF_Remove<ECS::SpotLightComponent>, &GetReflectedProperties<ECS::SpotLightComponent>, &REF_FindBulkKernels<ECS::SpotLightComponent>, &GetReflectedDeltaCodec<ECS::SpotLightComponent>, &REF_CaptureDelta<ECS::SpotLightComponent>, &REF_ApplyDeltas<ECS::SpotLightComponent>, &GetReflectedQuantizedFields<ECS::SpotLightComponent>, &REF_MemoryStats<ECS::SpotLightComponent>, &REF_Add<ECS::SpotLightComponent>},
+};
+
+constexpr ReflectedPooledClass g_reflectedPooledClasses[REFLECTED_POOLED_CLASS_COUNT] = {
+{3198549676u, "ECS::EntityDataComponent", &REF_MemoryStats<ECS::EntityDataComponent>},
+};
+} // namespace LinaEngineReflection
+    //REGTYPES_END - !! DO NOT MODIFY THIS LINE !!
+
+    void ReflectionRegistry::RegisterReflectedComponents()
+    {
+        //REGFUNC_BEGIN - !! DO NOT CHANGE THIS LINE !!
+#ifndef LINA_REFLECTION_LAZY
+uint32_t            count   = 0;
+ReflectedTypeEntry* entries = LinaEngineReflection::GetReflectedTypes(count);
+RegisterReflectedTypes(entries, count);
+#endif
         //REGFUNC_END - !! DO NOT CHANGE THIS LINE !!
     }
 } // namespace Lina
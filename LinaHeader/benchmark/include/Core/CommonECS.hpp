@@ -0,0 +1,63 @@
+/*
+This file is a part of: Lina Engine
+https://github.com/inanevin/LinaEngine
+
+Author: Inan Evin
+http://www.inanevin.com
+
+Copyright (c) [2018-2020] [Inan Evin]
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+/*
+Class: CommonECS
+
+Benchmark stand-in for the engine's ECS basics, only what the registry template uses.
+
+Timestamp: 10/18/2026 8:02:11 PM
+*/
+
+#pragma once
+
+#ifndef CommonECS_HPP
+#define CommonECS_HPP
+
+#include "ECS/Component.hpp"
+#include <cstdint>
+#include <entt/entity/registry.hpp>
+#include <entt/meta/meta.hpp>
+
+namespace Lina
+{
+    typedef uint32_t TypeID;
+
+    template <typename T>
+    TypeID GetTypeID()
+    {
+        return entt::internal::type_hash<T>();
+    }
+
+    namespace ECS
+    {
+        typedef entt::entity Entity;
+    } // namespace ECS
+} // namespace Lina
+
+#endif
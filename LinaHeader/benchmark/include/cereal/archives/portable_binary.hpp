@@ -0,0 +1,168 @@
+/*
+This file is a part of: Lina Engine
+https://github.com/inanevin/LinaEngine
+
+Author: Inan Evin
+http://www.inanevin.com
+
+Copyright (c) [2018-2020] [Inan Evin]
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+/*
+Class: PortableBinaryArchive
+
+Benchmark stand-in for cereal's portable binary archives, only what the registry template & the benchmark
+use. Arithmetic values & enums are written in the native byte order, binary data as it is, and classes
+through their serialize member, which cereal::access can reach when it is private.
+
+Timestamp: 10/19/2026 9:21:14 AM
+*/
+
+#pragma once
+
+#ifndef CerealPortableBinary_HPP
+#define CerealPortableBinary_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <istream>
+#include <ostream>
+#include <type_traits>
+#include <utility>
+
+namespace cereal
+{
+    template <typename Pointer>
+    struct BinaryData
+    {
+        Pointer     data;
+        std::size_t size;
+    };
+
+    template <typename Pointer>
+    BinaryData<Pointer> binary_data(Pointer data, std::size_t size)
+    {
+        return BinaryData<Pointer>{data, size};
+    }
+
+    class access
+    {
+    public:
+        template <typename Archive, typename Type>
+        static auto member_serialize(Archive& archive, Type& value) -> decltype(value.serialize(archive))
+        {
+            return value.serialize(archive);
+        }
+    };
+
+    namespace traits
+    {
+        template <typename Type, typename Archive, typename = void>
+        struct has_member_serialize : std::false_type
+        {
+        };
+
+        template <typename Type, typename Archive>
+        struct has_member_serialize<Type, Archive, std::void_t<decltype(access::member_serialize(std::declval<Archive&>(), std::declval<Type&>()))>> : std::true_type
+        {
+        };
+
+        template <typename Type, typename Archive>
+        struct is_output_serializable : std::integral_constant<bool, std::is_arithmetic_v<Type> || std::is_enum_v<Type> || has_member_serialize<Type, Archive>::value>
+        {
+        };
+
+        template <typename Type, typename Archive>
+        struct is_input_serializable : is_output_serializable<Type, Archive>
+        {
+        };
+    } // namespace traits
+
+    class PortableBinaryOutputArchive
+    {
+    public:
+        explicit PortableBinaryOutputArchive(std::ostream& stream) : m_stream(stream)
+        {
+        }
+
+        template <typename... Types>
+        PortableBinaryOutputArchive& operator()(Types&&... values)
+        {
+            (Process(values), ...);
+            return *this;
+        }
+
+    private:
+        template <typename Pointer>
+        void Process(const BinaryData<Pointer>& binary)
+        {
+            m_stream.write(static_cast<const char*>(static_cast<const void*>(binary.data)), static_cast<std::streamsize>(binary.size));
+        }
+
+        template <typename Type>
+        void Process(const Type& value)
+        {
+            if constexpr (std::is_arithmetic_v<Type> || std::is_enum_v<Type>)
+                m_stream.write(reinterpret_cast<const char*>(&value), sizeof(Type));
+            else
+                access::member_serialize(*this, const_cast<Type&>(value));
+        }
+
+    private:
+        std::ostream& m_stream;
+    };
+
+    class PortableBinaryInputArchive
+    {
+    public:
+        explicit PortableBinaryInputArchive(std::istream& stream) : m_stream(stream)
+        {
+        }
+
+        template <typename... Types>
+        PortableBinaryInputArchive& operator()(Types&&... values)
+        {
+            (Process(values), ...);
+            return *this;
+        }
+
+    private:
+        template <typename Pointer>
+        void Process(BinaryData<Pointer>& binary)
+        {
+            m_stream.read(static_cast<char*>(static_cast<void*>(binary.data)), static_cast<std::streamsize>(binary.size));
+        }
+
+        template <typename Type>
+        void Process(Type& value)
+        {
+            if constexpr (std::is_arithmetic_v<Type> || std::is_enum_v<Type>)
+                m_stream.read(reinterpret_cast<char*>(&value), sizeof(Type));
+            else
+                access::member_serialize(*this, value);
+        }
+
+    private:
+        std::istream& m_stream;
+    };
+} // namespace cereal
+
+#endif
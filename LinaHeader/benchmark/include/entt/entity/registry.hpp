@@ -0,0 +1,306 @@
+/*
+This file is a part of: Lina Engine
+https://github.com/inanevin/LinaEngine
+
+Author: Inan Evin
+http://www.inanevin.com
+
+Copyright (c) [2018-2020] [Inan Evin]
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+/*
+Class: registry
+
+Benchmark stand-in for EnTT's registry, only what the registry template & the benchmark use. Components
+live in pages of a fixed size and are iterated from the last one to the first, like in EnTT, so the
+page walks of the bulk kernels & memory stats run the same way. Signals are not modelled.
+
+Timestamp: 10/19/2026 9:12:30 AM
+*/
+
+#pragma once
+
+#ifndef EnttRegistry_HPP
+#define EnttRegistry_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+#include <memory>
+#include <typeindex>
+#include <unordered_map>
+#include <vector>
+
+namespace entt
+{
+    enum class entity : uint32_t
+    {
+    };
+
+    namespace internal
+    {
+        class basic_storage_base
+        {
+        public:
+            virtual ~basic_storage_base() = default;
+            virtual void clear()          = 0;
+        };
+    } // namespace internal
+
+    template <typename Type>
+    class basic_storage : public internal::basic_storage_base
+    {
+    public:
+        static constexpr std::size_t page_size = 1024;
+
+        class iterator
+        {
+        public:
+            typedef std::random_access_iterator_tag iterator_category;
+            typedef Type                            value_type;
+            typedef std::ptrdiff_t                  difference_type;
+            typedef Type*                           pointer;
+            typedef Type&                           reference;
+
+            iterator(basic_storage* storage, std::ptrdiff_t position) : m_storage(storage), m_position(position)
+            {
+            }
+
+            // Position counts down, the last element is visited first.
+            Type& operator*() const
+            {
+                return m_storage->at(static_cast<std::size_t>(m_position - 1));
+            }
+
+            iterator operator+(std::ptrdiff_t offset) const
+            {
+                return iterator(m_storage, m_position - offset);
+            }
+
+            iterator& operator+=(std::ptrdiff_t offset)
+            {
+                m_position -= offset;
+                return *this;
+            }
+
+            iterator& operator++()
+            {
+                --m_position;
+                return *this;
+            }
+
+            bool operator==(const iterator& other) const
+            {
+                return m_position == other.m_position;
+            }
+
+            bool operator!=(const iterator& other) const
+            {
+                return m_position != other.m_position;
+            }
+
+        private:
+            basic_storage* m_storage  = nullptr;
+            std::ptrdiff_t m_position = 0;
+        };
+
+        iterator begin() const
+        {
+            return iterator(const_cast<basic_storage*>(this), static_cast<std::ptrdiff_t>(m_dense.size()));
+        }
+
+        iterator end() const
+        {
+            return iterator(const_cast<basic_storage*>(this), 0);
+        }
+
+        std::size_t size() const
+        {
+            return m_dense.size();
+        }
+
+        std::size_t capacity() const
+        {
+            return m_pages.size() * page_size;
+        }
+
+        bool contains(entity entt) const
+        {
+            const std::size_t index = static_cast<std::size_t>(entt);
+            return index < m_sparse.size() && m_sparse[index] != npos;
+        }
+
+        Type& get(entity entt)
+        {
+            return at(m_sparse[static_cast<std::size_t>(entt)]);
+        }
+
+        const std::vector<entity>& entities() const
+        {
+            return m_dense;
+        }
+
+        template <typename... Args>
+        Type& emplace(entity entt, Args&&... args)
+        {
+            const std::size_t position = m_dense.size();
+            if (position / page_size == m_pages.size())
+                m_pages.emplace_back(new Type[page_size]);
+
+            at(position) = Type{std::forward<Args>(args)...};
+            m_dense.push_back(entt);
+
+            const std::size_t index = static_cast<std::size_t>(entt);
+            if (index >= m_sparse.size())
+                m_sparse.resize(index + 1, npos);
+
+            m_sparse[index] = position;
+            return at(position);
+        }
+
+        // Swaps the last component into the removed one's place, like EnTT.
+        void remove(entity entt)
+        {
+            if (!contains(entt))
+                return;
+
+            const std::size_t position = m_sparse[static_cast<std::size_t>(entt)];
+            const std::size_t last     = m_dense.size() - 1;
+
+            at(position)                                        = std::move(at(last));
+            m_dense[position]                                   = m_dense[last];
+            m_sparse[static_cast<std::size_t>(m_dense[last])] = position;
+            m_sparse[static_cast<std::size_t>(entt)]           = npos;
+            m_dense.pop_back();
+        }
+
+        void clear() override
+        {
+            m_pages.clear();
+            m_dense.clear();
+            m_sparse.clear();
+        }
+
+    private:
+        static constexpr std::size_t npos = static_cast<std::size_t>(-1);
+
+        Type& at(std::size_t position)
+        {
+            return m_pages[position / page_size][position % page_size];
+        }
+
+    private:
+        std::vector<std::unique_ptr<Type[]>> m_pages;
+        std::vector<entity>                  m_dense;
+        std::vector<std::size_t>             m_sparse;
+    };
+
+    class registry
+    {
+    public:
+        registry()                = default;
+        virtual ~registry()       = default;
+        registry(const registry&) = delete;
+        registry& operator=(const registry&) = delete;
+
+        template <typename Type>
+        basic_storage<Type>& storage()
+        {
+            std::unique_ptr<internal::basic_storage_base>& pool = m_pools[std::type_index(typeid(Type))];
+            if (!pool)
+                pool.reset(new basic_storage<Type>());
+
+            return *static_cast<basic_storage<Type>*>(pool.get());
+        }
+
+        entity create()
+        {
+            return static_cast<entity>(m_next++);
+        }
+
+        template <typename It>
+        void create(It first, It last)
+        {
+            for (; first != last; ++first)
+                *first = create();
+        }
+
+        // Drops every component & starts numbering entities from zero again.
+        void clear()
+        {
+            for (auto& pool : m_pools)
+                pool.second->clear();
+
+            m_next = 0;
+        }
+
+        template <typename Type>
+        Type& get(entity entt)
+        {
+            return storage<Type>().get(entt);
+        }
+
+        template <typename Type, typename... Args>
+        Type& emplace(entity entt, Args&&... args)
+        {
+            return storage<Type>().emplace(entt, std::forward<Args>(args)...);
+        }
+
+        template <typename Type>
+        Type& emplace_or_replace(entity entt, const Type& value)
+        {
+            basic_storage<Type>& pool = storage<Type>();
+            return pool.contains(entt) ? (pool.get(entt) = value) : pool.emplace(entt, value);
+        }
+
+        template <typename Type>
+        Type& replace(entity entt, const Type& value)
+        {
+            return get<Type>(entt) = value;
+        }
+
+        template <typename Type>
+        void remove(entity entt)
+        {
+            storage<Type>().remove(entt);
+        }
+
+        template <typename Type, typename It>
+        void remove(It first, It last)
+        {
+            basic_storage<Type>& pool = storage<Type>();
+            for (; first != last; ++first)
+                pool.remove(*first);
+        }
+
+        template <typename Type>
+        bool all_of(entity entt)
+        {
+            return storage<Type>().contains(entt);
+        }
+
+    private:
+        std::unordered_map<std::type_index, std::unique_ptr<internal::basic_storage_base>> m_pools;
+        uint32_t                                                                            m_next = 0;
+    };
+} // namespace entt
+
+#endif
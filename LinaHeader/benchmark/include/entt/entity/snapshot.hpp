@@ -0,0 +1,99 @@
+/*
+This file is a part of: Lina Engine
+https://github.com/inanevin/LinaEngine
+
+Author: Inan Evin
+http://www.inanevin.com
+
+Copyright (c) [2018-2020] [Inan Evin]
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+/*
+Class: snapshot
+
+Benchmark stand-in for EnTT's snapshot & snapshot loader. A component pool is archived as its size followed
+by every entity & its component, the loader emplaces or replaces them in the target registry.
+
+Timestamp: 10/19/2026 9:14:02 AM
+*/
+
+#pragma once
+
+#ifndef EnttSnapshot_HPP
+#define EnttSnapshot_HPP
+
+#include "entt/entity/registry.hpp"
+
+namespace entt
+{
+    class snapshot
+    {
+    public:
+        explicit snapshot(registry& source) : m_registry(source)
+        {
+        }
+
+        template <typename Component, typename Archive>
+        const snapshot& component(Archive& archive) const
+        {
+            basic_storage<Component>& pool = m_registry.storage<Component>();
+            archive(static_cast<uint32_t>(pool.size()));
+
+            for (entity entt : pool.entities())
+                archive(entt, pool.get(entt));
+
+            return *this;
+        }
+
+    private:
+        registry& m_registry;
+    };
+
+    class snapshot_loader
+    {
+    public:
+        explicit snapshot_loader(registry& target) : m_registry(target)
+        {
+        }
+
+        template <typename Component, typename Archive>
+        snapshot_loader& component(Archive& archive)
+        {
+            uint32_t count = 0;
+            archive(count);
+
+            for (uint32_t i = 0; i < count; i++)
+            {
+                entity    entt = entity();
+                Component value;
+                archive(entt, value);
+                m_registry.emplace_or_replace<Component>(entt, value);
+            }
+
+            return *this;
+        }
+
+    private:
+        registry& m_registry;
+    };
+} // namespace entt
+
+#endif
@@ -0,0 +1,122 @@
+/*
+This file is a part of: Lina Engine
+https://github.com/inanevin/LinaEngine
+
+Author: Inan Evin
+http://www.inanevin.com
+
+Copyright (c) [2018-2020] [Inan Evin]
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+/*
+Class: meta_factory
+
+Benchmark stand-in for EnTT's meta factory. entt::meta<T>() adds T to the meta context, reset() removes it
+along with everything registered on it.
+
+Timestamp: 10/19/2026 9:18:20 AM
+*/
+
+#pragma once
+
+#ifndef EnttMetaFactory_HPP
+#define EnttMetaFactory_HPP
+
+#include "entt/meta/meta.hpp"
+
+namespace entt
+{
+    template <typename Type>
+    class meta_factory
+    {
+    public:
+        meta_factory type()
+        {
+            return *this;
+        }
+
+        template <auto Data>
+        meta_factory data(id_type id)
+        {
+            internal::resolve_node<Type>().m_data[id].m_id = id;
+            return *this;
+        }
+
+        template <auto Func, typename Policy = as_is_t>
+        meta_factory func(id_type id)
+        {
+            typedef internal::meta_thunk<Func, decltype(Func)> Thunk;
+            internal::meta_func_node&                          node = internal::resolve_node<Type>().m_funcs[id];
+            node.m_id                                              = id;
+            node.m_arity                                           = Thunk::arity;
+            node.m_invoke                                          = &Thunk::invoke;
+            return *this;
+        }
+
+        // Pairs record their first member, keys given without a pair are recorded as they are.
+        template <typename... Props>
+        meta_factory props(Props&&... props)
+        {
+            (AddProp(props), ...);
+            return *this;
+        }
+
+        void reset()
+        {
+            internal::meta_type_node& node = internal::resolve_node<Type>();
+            internal::meta_context().erase(node.m_id);
+            node.m_props.clear();
+            node.m_data.clear();
+            node.m_funcs.clear();
+        }
+
+    private:
+        template <typename Prop, typename = void>
+        struct IsPair : std::false_type
+        {
+        };
+
+        template <typename Prop>
+        struct IsPair<Prop, std::void_t<decltype(std::declval<Prop>().first)>> : std::true_type
+        {
+        };
+
+        template <typename Prop>
+        void AddProp(const Prop& prop)
+        {
+            if constexpr (IsPair<Prop>::value)
+                internal::resolve_node<Type>().m_props.push_back(static_cast<id_type>(prop.first));
+            else if constexpr (std::is_integral_v<Prop>)
+                internal::resolve_node<Type>().m_props.push_back(static_cast<id_type>(prop));
+        }
+    };
+
+    template <typename Type>
+    meta_factory<Type> meta()
+    {
+        internal::meta_type_node& node = internal::resolve_node<Type>();
+        node.m_id                      = internal::type_hash<Type>();
+        internal::meta_context()[node.m_id] = &node;
+        return meta_factory<Type>();
+    }
+} // namespace entt
+
+#endif
@@ -0,0 +1,252 @@
+/*
+This file is a part of: Lina Engine
+https://github.com/inanevin/LinaEngine
+
+Author: Inan Evin
+http://www.inanevin.com
+
+Copyright (c) [2018-2020] [Inan Evin]
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+/*
+Class: meta
+
+Benchmark stand-in for EnTT's meta system, only what the registry template & the benchmark use. Types,
+data members & funcs are kept in hash maps keyed by their id, props only record their keys. Funcs are
+invoked through a type-erased thunk taking pointers to the arguments, which have to be passed with the
+exact parameter types; return values are dropped.
+
+Timestamp: 10/19/2026 9:16:45 AM
+*/
+
+#pragma once
+
+#ifndef EnttMeta_HPP
+#define EnttMeta_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <type_traits>
+#include <typeinfo>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+namespace entt
+{
+    typedef uint32_t id_type;
+
+    namespace literals
+    {
+        // 32 bit FNV-1a, the same as EnTT's hashed strings.
+        constexpr id_type operator""_hs(const char* str, std::size_t)
+        {
+            id_type hash = 2166136261u;
+            for (; *str != '\0'; str++)
+                hash = (hash ^ static_cast<uint8_t>(*str)) * 16777619u;
+            return hash;
+        }
+    } // namespace literals
+
+    struct as_is_t
+    {
+    };
+
+    struct as_void_t
+    {
+    };
+
+    struct as_ref_t
+    {
+    };
+
+    struct meta_handle
+    {
+    };
+
+    template <typename Type>
+    Type& forward_as_meta(Type& value)
+    {
+        return value;
+    }
+
+    namespace internal
+    {
+        struct meta_data_node
+        {
+            id_type m_id = 0;
+        };
+
+        struct meta_func_node
+        {
+            id_type     m_id     = 0;
+            std::size_t m_arity  = 0;
+            void (*m_invoke)(void* const* args) = nullptr;
+        };
+
+        struct meta_type_node
+        {
+            id_type                                     m_id = 0;
+            std::vector<id_type>                        m_props;
+            std::unordered_map<id_type, meta_data_node> m_data;
+            std::unordered_map<id_type, meta_func_node> m_funcs;
+        };
+
+        inline std::unordered_map<id_type, meta_type_node*>& meta_context()
+        {
+            static std::unordered_map<id_type, meta_type_node*> s_context;
+            return s_context;
+        }
+
+        template <typename Type>
+        meta_type_node& resolve_node()
+        {
+            static meta_type_node s_node;
+            return s_node;
+        }
+
+        template <typename Type>
+        id_type type_hash()
+        {
+            id_type hash = 2166136261u;
+            for (const char* name = typeid(Type).name(); *name != '\0'; name++)
+                hash = (hash ^ static_cast<uint8_t>(*name)) * 16777619u;
+            return hash;
+        }
+
+        template <auto Func, typename Signature>
+        struct meta_thunk;
+
+        template <auto Func, typename Ret, typename... Args>
+        struct meta_thunk<Func, Ret (*)(Args...)>
+        {
+            static constexpr std::size_t arity = sizeof...(Args);
+
+            static void invoke(void* const* args)
+            {
+                invoke(args, std::index_sequence_for<Args...>{});
+            }
+
+            template <std::size_t... Index>
+            static void invoke([[maybe_unused]] void* const* args, std::index_sequence<Index...>)
+            {
+                Func(*static_cast<std::remove_reference_t<Args>*>(args[Index])...);
+            }
+        };
+    } // namespace internal
+
+    class meta_data
+    {
+    public:
+        meta_data(const internal::meta_data_node* node = nullptr) : m_node(node)
+        {
+        }
+
+        explicit operator bool() const
+        {
+            return m_node != nullptr;
+        }
+
+        id_type id() const
+        {
+            return m_node->m_id;
+        }
+
+    private:
+        const internal::meta_data_node* m_node = nullptr;
+    };
+
+    class meta_func
+    {
+    public:
+        meta_func(const internal::meta_func_node* node = nullptr) : m_node(node)
+        {
+        }
+
+        explicit operator bool() const
+        {
+            return m_node != nullptr;
+        }
+
+        id_type id() const
+        {
+            return m_node->m_id;
+        }
+
+        // Returns false if there is no such func or it takes another number of arguments.
+        template <typename... Args>
+        bool invoke(meta_handle, Args&&... args) const
+        {
+            if (m_node == nullptr || m_node->m_arity != sizeof...(Args))
+                return false;
+
+            void* const pointers[sizeof...(Args) + 1] = {const_cast<void*>(static_cast<const void*>(std::addressof(args)))..., nullptr};
+            m_node->m_invoke(pointers);
+            return true;
+        }
+
+    private:
+        const internal::meta_func_node* m_node = nullptr;
+    };
+
+    class meta_type
+    {
+    public:
+        meta_type(const internal::meta_type_node* node = nullptr) : m_node(node)
+        {
+        }
+
+        explicit operator bool() const
+        {
+            return m_node != nullptr;
+        }
+
+        id_type id() const
+        {
+            return m_node->m_id;
+        }
+
+        meta_data data(id_type id) const
+        {
+            const auto it = m_node->m_data.find(id);
+            return it != m_node->m_data.end() ? meta_data(&it->second) : meta_data();
+        }
+
+        std::vector<meta_data> data() const
+        {
+            std::vector<meta_data> data;
+            for (auto& pair : m_node->m_data)
+                data.push_back(meta_data(&pair.second));
+            return data;
+        }
+
+        meta_func func(id_type id) const
+        {
+            const auto it = m_node->m_funcs.find(id);
+            return it != m_node->m_funcs.end() ? meta_func(&it->second) : meta_func();
+        }
+
+    private:
+        const internal::meta_type_node* m_node = nullptr;
+    };
+} // namespace entt
+
+#endif
@@ -0,0 +1,67 @@
+/*
+This file is a part of: Lina Engine
+https://github.com/inanevin/LinaEngine
+
+Author: Inan Evin
+http://www.inanevin.com
+
+Copyright (c) [2018-2020] [Inan Evin]
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+/*
+Class: resolve
+
+Benchmark stand-in for EnTT's meta lookups, by type, by id & over every registered type.
+
+Timestamp: 10/19/2026 9:19:31 AM
+*/
+
+#pragma once
+
+#ifndef EnttMetaResolve_HPP
+#define EnttMetaResolve_HPP
+
+#include "entt/meta/meta.hpp"
+
+namespace entt
+{
+    template <typename Type>
+    meta_type resolve()
+    {
+        return meta_type(&internal::resolve_node<Type>());
+    }
+
+    inline meta_type resolve(id_type id)
+    {
+        const auto it = internal::meta_context().find(id);
+        return it != internal::meta_context().end() ? meta_type(it->second) : meta_type();
+    }
+
+    inline std::vector<meta_type> resolve()
+    {
+        std::vector<meta_type> types;
+        for (auto& pair : internal::meta_context())
+            types.push_back(meta_type(pair.second));
+        return types;
+    }
+} // namespace entt
+
+#endif
@@ -0,0 +1,332 @@
+/*
+This file is a part of: Lina Engine
+https://github.com/inanevin/LinaEngine
+
+Author: Inan Evin
+http://www.inanevin.com
+
+Copyright (c) [2018-2020] [Inan Evin]
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+#include "BenchComponents.hpp"
+#include "Core/ReflectionRegistry.hpp"
+#include "ECS/Registry.hpp"
+#include "ReflectedComponents.hpp"
+#include "ReflectedTypeTable.hpp"
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <entt/entity/snapshot.hpp>
+#include <entt/meta/meta.hpp>
+#include <entt/meta/resolve.hpp>
+#include <fstream>
+#include <functional>
+#include <iostream>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#define LOOKUP_COUNT 1000000
+
+using namespace Lina;
+using namespace Lina::BenchmarkReflection;
+using namespace entt::literals;
+
+namespace
+{
+    struct BenchmarkResult
+    {
+        std::string m_name       = "";
+        std::string m_path       = "";
+        size_t      m_entities   = 0;
+        size_t      m_operations = 0;
+        double      m_bestMs     = 0.0;
+        double      m_meanMs     = 0.0;
+    };
+
+    std::vector<BenchmarkResult> results;
+    int                          runs = 3;
+
+    /// <summary>
+    /// Runs setup & body the given number of times, only the body is timed.
+    /// </summary>
+    void Measure(const std::string& name, const std::string& path, size_t entities, size_t operations, const std::function<void()>& setup, const std::function<void()>& body)
+    {
+        BenchmarkResult result;
+        result.m_name       = name;
+        result.m_path       = path;
+        result.m_entities   = entities;
+        result.m_operations = operations;
+
+        for (int run = 0; run < runs; run++)
+        {
+            if (setup)
+                setup();
+
+            const auto start = std::chrono::steady_clock::now();
+            body();
+            const double ms = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+
+            result.m_bestMs = run == 0 ? ms : std::min(result.m_bestMs, ms);
+            result.m_meanMs += ms / runs;
+        }
+
+        results.push_back(result);
+    }
+
+    void UnregisterAll()
+    {
+        uint32_t            count   = 0;
+        ReflectedTypeEntry* entries = GetReflectedTypes(count);
+
+        for (uint32_t i = 0; i < count; i++)
+            Unregister(entries[i]);
+    }
+
+    void BenchmarkRegistration()
+    {
+        ReflectionRegistry registry;
+        uint32_t           count = 0;
+        GetReflectedTypes(count);
+
+        Measure("register", "RegisterReflectedComponents", 0, count, UnregisterAll, [&]() { registry.RegisterReflectedComponents(); });
+
+        // Lookups need every type registered.
+        RegisterReflectedTypes();
+    }
+
+    void BenchmarkLookups()
+    {
+        std::vector<entt::id_type>                            typeIds;
+        std::vector<std::pair<entt::meta_type, entt::id_type>> dataIds;
+
+        for (entt::meta_type type : entt::resolve())
+        {
+            typeIds.push_back(type.id());
+
+            for (entt::meta_data data : type.data())
+                dataIds.push_back(std::make_pair(type, data.id()));
+        }
+
+        if (typeIds.empty() || dataIds.empty())
+            return;
+
+        size_t found = 0;
+
+        Measure("resolve_type", "entt::resolve(id)", 0, LOOKUP_COUNT, nullptr, [&]() {
+            for (size_t i = 0; i < LOOKUP_COUNT; i++)
+                found += static_cast<bool>(entt::resolve(typeIds[i % typeIds.size()]));
+        });
+
+        Measure("resolve_property", "meta_type::data(hash)", 0, LOOKUP_COUNT, nullptr, [&]() {
+            for (size_t i = 0; i < LOOKUP_COUNT; i++)
+            {
+                auto& [type, id] = dataIds[i % dataIds.size()];
+                found += static_cast<bool>(type.data(id));
+            }
+        });
+
+        Measure("resolve_table", "FindReflectedType(hash)", 0, LOOKUP_COUNT, nullptr, [&]() {
+            uint32_t            count   = 0;
+            ReflectedTypeEntry* entries = GetReflectedTypes(count);
+
+            for (size_t i = 0; i < LOOKUP_COUNT; i++)
+                found += Lina::FindReflectedType(entries, count, entries[i % count].m_hash) != nullptr;
+        });
+
+        // Keeps the lookups from being optimized away.
+        if (found == 0)
+            std::cerr << "Lina Header Benchmark: no lookup succeeded." << std::endl;
+    }
+
+    void BenchmarkFuncs(size_t entityCount)
+    {
+        typedef ECS::BenchComponent0 Type;
+
+        ECS::Registry*                   registry = ECS::Registry::Get();
+        const entt::meta_type            type     = entt::resolve<Type>();
+        const ReflectedComponentFunctions& direct = g_reflectedComponentFunctions[ReflectedComponentID<Type>::value];
+        std::vector<ECS::Entity>         sources(entityCount);
+        std::vector<ECS::Entity>         targets(entityCount);
+
+        registry->clear();
+        registry->create(sources.begin(), sources.end());
+        registry->create(targets.begin(), targets.end());
+
+        for (auto entity : sources)
+            registry->emplace<Type>(entity);
+
+        auto removeTargets = [&]() { registry->remove<Type>(targets.begin(), targets.end()); };
+
+        Measure("get", "meta", entityCount, entityCount, nullptr, [&]() {
+            entt::meta_func func = type.func("get"_hs);
+            for (auto entity : sources)
+                func.invoke({}, entity);
+        });
+
+        Measure("reset", "meta", entityCount, entityCount, nullptr, [&]() {
+            entt::meta_func func = type.func("reset"_hs);
+            for (auto entity : sources)
+                func.invoke({}, entity);
+        });
+
+        Measure("reset", "dispatch", entityCount, entityCount, nullptr, [&]() {
+            for (auto entity : sources)
+                direct.m_reset(entity);
+        });
+
+        Measure("reset", "batch", entityCount, entityCount, nullptr, [&]() { direct.m_resetEntities(sources.data(), static_cast<uint32_t>(sources.size())); });
+
+        Measure("clone", "meta", entityCount, entityCount, removeTargets, [&]() {
+            entt::meta_func func = type.func("clone"_hs);
+            for (size_t i = 0; i < entityCount; i++)
+                func.invoke({}, sources[i], targets[i]);
+        });
+
+        Measure("clone", "dispatch", entityCount, entityCount, removeTargets, [&]() {
+            for (size_t i = 0; i < entityCount; i++)
+                direct.m_clone(sources[i], targets[i]);
+        });
+
+        removeTargets();
+        std::string serialized = "";
+
+        Measure("serialize", "meta", entityCount, entityCount, nullptr, [&]() {
+            std::stringstream                   stream;
+            cereal::PortableBinaryOutputArchive archive(stream);
+            entt::snapshot                      snapshot{*registry};
+            type.func("serialize"_hs).invoke({}, entt::forward_as_meta(snapshot), entt::forward_as_meta(archive));
+            serialized = stream.str();
+        });
+
+        Measure("serialize", "dispatch", entityCount, entityCount, nullptr, [&]() {
+            std::stringstream                   stream;
+            cereal::PortableBinaryOutputArchive archive(stream);
+            entt::snapshot                      snapshot{*registry};
+            direct.m_serialize(snapshot, archive);
+            serialized = stream.str();
+        });
+
+        ECS::Registry loaded;
+
+        Measure(
+            "deserialize", "meta", entityCount, entityCount, [&]() { loaded.clear(); },
+            [&]() {
+                std::stringstream                  stream(serialized);
+                cereal::PortableBinaryInputArchive archive(stream);
+                entt::snapshot_loader              loader{loaded};
+                type.func("deserialize"_hs).invoke({}, entt::forward_as_meta(loader), entt::forward_as_meta(archive));
+            });
+
+        Measure(
+            "deserialize", "dispatch", entityCount, entityCount, [&]() { loaded.clear(); },
+            [&]() {
+                std::stringstream                  stream(serialized);
+                cereal::PortableBinaryInputArchive archive(stream);
+                entt::snapshot_loader              loader{loaded};
+                direct.m_deserializeSection(stream, loader, archive);
+            });
+
+        if (loaded.storage<Type>().size() != entityCount)
+            std::cerr << "Lina Header Benchmark: deserialized " << loaded.storage<Type>().size() << " of " << entityCount << " components." << std::endl;
+
+        registry->clear();
+    }
+
+    void WriteResults(std::ostream& out)
+    {
+        uint32_t typeCount = 0;
+        GetReflectedTypes(typeCount);
+
+        out << "{\n";
+        out << "  \"components\": " << LINA_HEADER_BENCHMARK_COMPONENTS << ",\n";
+        out << "  \"reflected_types\": " << typeCount << ",\n";
+        out << "  \"runs\": " << runs << ",\n";
+        out << "  \"results\": [\n";
+
+        for (size_t i = 0; i < results.size(); i++)
+        {
+            const BenchmarkResult& result = results[i];
+            char                   row[512];
+            std::snprintf(row, sizeof(row), "    {\"name\": \"%s\", \"path\": \"%s\", \"entities\": %zu, \"operations\": %zu, \"best_ms\": %.6f, \"mean_ms\": %.6f, \"best_ns_per_op\": %.3f}", result.m_name.c_str(),
+                          result.m_path.c_str(), result.m_entities, result.m_operations, result.m_bestMs, result.m_meanMs, result.m_operations > 0 ? result.m_bestMs * 1000000.0 / result.m_operations : 0.0);
+            out << row << (i + 1 < results.size() ? ",\n" : "\n");
+        }
+
+        out << "  ]\n";
+        out << "}\n";
+    }
+} // namespace
+
+int main(int argc, char** argv)
+{
+    // --entities 10000,100000,1000000 --runs 3 --output results.json
+    std::vector<size_t> entityCounts = {10000, 100000, 1000000};
+    std::string         outputPath   = "";
+
+    for (int i = 1; i + 1 < argc; i += 2)
+    {
+        const std::string key   = argv[i];
+        const std::string value = argv[i + 1];
+
+        if (key.compare("--entities") == 0)
+        {
+            entityCounts.clear();
+            std::stringstream stream(value);
+            std::string       count;
+
+            while (getline(stream, count, ','))
+                entityCounts.push_back(std::strtoull(count.c_str(), nullptr, 10));
+        }
+        else if (key.compare("--runs") == 0)
+            runs = std::max(1, std::atoi(value.c_str()));
+        else if (key.compare("--output") == 0)
+            outputPath = value;
+        else
+        {
+            std::cerr << "Lina Header Benchmark: unknown option " << key << std::endl;
+            return 1;
+        }
+    }
+
+    BenchmarkRegistration();
+    BenchmarkLookups();
+
+    for (size_t entityCount : entityCounts)
+        BenchmarkFuncs(entityCount);
+
+    if (outputPath.empty())
+    {
+        WriteResults(std::cout);
+        return 0;
+    }
+
+    std::ofstream file(outputPath);
+    if (!file.is_open())
+    {
+        std::cerr << "Lina Header Benchmark: could not open " << outputPath << " for writing." << std::endl;
+        return 1;
+    }
+
+    WriteResults(file);
+    return 0;
+}
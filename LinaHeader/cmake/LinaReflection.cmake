@@ -0,0 +1,71 @@
+#-------------------------------------------------------------------------------------------------------------------------------------------------------------------------
+# Author: Inan Evin
+# www.inanevin.com
+# 
+# Copyright (C) 2018 Inan Evin
+# 
+# Licensed under the Apache License, Version 2.0 (the "License"); you may not use this file except in compliance with the License. You may obtain a copy of the License at
+#
+# http://www.apache.org/licenses/LICENSE-2.0
+#
+# Unless required by applicable law or agreed to in writing, software distributed under the License is distributed on an "AS IS" BASIS, 
+# WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. See the License for the specific language governing permissions 
+# and limitations under the License.
+
+#--------------------------------------------------------------------
+# Reflection helpers for targets consuming the generated registry
+#--------------------------------------------------------------------
+
+# Precompiles the header written by the tool's "pch" module option for the registry source only. The source is moved
+# out of the target into an OBJECT library <TARGET>Reflection, which compiles it with the target's flags, include
+# directories & definitions, usage requirements of its dependencies included, and is linked back into the target.
+# The target's own precompiled headers are left untouched. Call it from the directory that creates the target.
+# Usage: lina_reflection_pch(LinaEngine ${CMAKE_CURRENT_SOURCE_DIR}/src/Core/ReflectionRegistry.cpp ${CMAKE_CURRENT_SOURCE_DIR}/src/Core/ReflectionRegistryPCH.hpp)
+function(lina_reflection_pch TARGET REGISTRY_SOURCE PCH_HEADER)
+	if(${CMAKE_VERSION} VERSION_LESS "3.16")
+		message(WARNING "lina_reflection_pch: precompiled headers need CMake 3.16, ${TARGET} is built without.")
+		return()
+	endif()
+
+	get_filename_component(registry_path "${REGISTRY_SOURCE}" ABSOLUTE)
+	get_target_property(target_sources ${TARGET} SOURCES)
+	get_target_property(target_dir ${TARGET} SOURCE_DIR)
+
+	set(remaining_sources "")
+	foreach(source IN LISTS target_sources)
+		get_filename_component(source_path "${source}" ABSOLUTE BASE_DIR "${target_dir}")
+		if(NOT source_path STREQUAL registry_path)
+			list(APPEND remaining_sources ${source})
+		endif()
+	endforeach()
+	set_property(TARGET ${TARGET} PROPERTY SOURCES ${remaining_sources})
+
+	set(object_target ${TARGET}Reflection)
+	add_library(${object_target} OBJECT ${registry_path})
+	target_include_directories(${object_target} PRIVATE $<TARGET_PROPERTY:${TARGET},INCLUDE_DIRECTORIES>)
+	target_compile_definitions(${object_target} PRIVATE $<TARGET_PROPERTY:${TARGET},COMPILE_DEFINITIONS>)
+	target_compile_options(${object_target} PRIVATE $<TARGET_PROPERTY:${TARGET},COMPILE_OPTIONS>)
+	target_compile_features(${object_target} PRIVATE cxx_std_17)
+
+	# Objects going into a shared library have to be position independent like the target's own.
+	get_target_property(target_type ${TARGET} TYPE)
+	get_target_property(target_pic ${TARGET} POSITION_INDEPENDENT_CODE)
+	if(target_pic OR target_type STREQUAL "SHARED_LIBRARY" OR target_type STREQUAL "MODULE_LIBRARY")
+		set_target_properties(${object_target} PROPERTIES POSITION_INDEPENDENT_CODE ON)
+	endif()
+
+	target_precompile_headers(${object_target} PRIVATE ${PCH_HEADER})
+
+	target_sources(${TARGET} PRIVATE $<TARGET_OBJECTS:${object_target}>)
+endfunction()
+
+# Builds the translation unit written by the tool's "layout-report" module option with the usage requirements
+# of the target owning the reflected headers, a component exceeding its layout budget fails the build.
+# Building <NAME>Run runs the report.
+# Usage: lina_layout_report(LinaEngineLayout LinaEngine ${CMAKE_CURRENT_SOURCE_DIR}/src/Core/LayoutReport.cpp)
+function(lina_layout_report NAME TARGET REPORT_SOURCE)
+	add_executable(${NAME} ${REPORT_SOURCE})
+	target_link_libraries(${NAME} PRIVATE ${TARGET})
+	target_compile_features(${NAME} PRIVATE cxx_std_17)
+	add_custom_target(${NAME}Run COMMAND ${NAME} COMMENT "Component layout report" VERBATIM)
+endfunction()
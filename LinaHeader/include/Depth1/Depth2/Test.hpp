@@ -82,6 +82,23 @@ namespace Lina::ECS
         Entity           m_parent = entt::null;
 
         virtual void SetIsEnabled(bool isEnabled) override;
+
+        // Heap of the children set & the name, reported through the "memstats" meta func.
+        size_t GetOwnedHeapSize() const
+        {
+            // Mirrors a red-black tree node of the set, so the padding around the color & the entity is counted.
+            // Strings own nothing until they outgrow the small buffer.
+            struct SetNode
+            {
+                int    m_color;
+                void*  m_links[3];
+                Entity m_entity;
+            };
+
+            const size_t name = m_name.capacity() > std::string().capacity() ? m_name.capacity() + 1 : 0;
+            return m_children.size() * sizeof(SetNode) + name;
+        }
+
         /* TRANSFORM OPERATIONS */
 
         Matrix ToMatrix()
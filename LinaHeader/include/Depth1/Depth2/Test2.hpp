@@ -96,10 +96,10 @@ namespace Lina::ECS
         LINA_PROPERTY("Distance", "Float", "Light Distance", "")
         float m_distance = 0;
 
-        LINA_PROPERTY("Cutoff", "Float", "The light will gradually dim from the edges of the cone defined by the Cutoff, to the cone defined by the Outer Cutoff.", "")
+        LINA_PROPERTY("Cutoff", "Float", "The light will gradually dim from the edges of the cone defined by the Cutoff, to the cone defined by the Outer Cutoff.", "", "0, 1, 0.0001")
         float m_cutoff = Math::Cos(Math::ToRadians(12.5f));
 
-        LINA_PROPERTY("Outer Cutoff", "Float", "The light will gradually dim from the edges of the cone defined by the Cutoff, to the cone defined by the Outer Cutoff.", "")
+        LINA_PROPERTY("Outer Cutoff", "Float", "The light will gradually dim from the edges of the cone defined by the Cutoff, to the cone defined by the Outer Cutoff.", "", "0, 1, 0.0001")
         float m_outerCutoff = Math::Cos(Math::ToRadians(17.5f));
 
         template <class Archive>
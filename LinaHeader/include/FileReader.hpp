@@ -0,0 +1,147 @@
+/*
+This file is a part of: Lina Engine
+https://github.com/inanevin/LinaEngine
+
+Author: Inan Evin
+http://www.inanevin.com
+
+Copyright (c) [2018-2020] [Inan Evin]
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+/*
+Class: FileReader
+
+Reads a batch of files into memory & hands each one over as soon as it is complete, in any order.
+The blocking reader opens & reads the files one after another. On Linux, the io_uring reader
+keeps many opens & reads in flight at once, which hides most of the latency of a cold page cache.
+
+Timestamp: 10/18/2026 2:17:44 PM
+*/
+
+#pragma once
+
+#ifndef FileReader_HPP
+#define FileReader_HPP
+
+#include <functional>
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace Lina
+{
+    enum class FileReaderBackend
+    {
+        Blocking,
+        Uring,
+    };
+
+    class FileReader
+    {
+    public:
+        typedef std::function<void(size_t index, std::string& content)> ReadCallback;
+
+        virtual ~FileReader() = default;
+
+        /// <summary>
+        /// Reads all files & calls onRead with the index of the file within paths. Files that can't be read are skipped.
+        /// </summary>
+        virtual void ReadFiles(const std::vector<std::string>& paths, const ReadCallback& onRead) = 0;
+
+        /// <summary>
+        /// Creates the requested backend, falls back to the blocking reader if it is not available.
+        /// </summary>
+        virtual FileReaderBackend GetBackend() const = 0;
+
+        static std::unique_ptr<FileReader> Create(FileReaderBackend backend);
+        static const char*                 GetBackendName(FileReaderBackend backend);
+
+        /// <summary>
+        /// Drops the file's pages from the OS page cache so that the next read is cold, returns false if unsupported.
+        /// </summary>
+        static bool EvictFromPageCache(const std::string& path);
+    };
+
+    class BlockingFileReader : public FileReader
+    {
+    public:
+        virtual void ReadFiles(const std::vector<std::string>& paths, const ReadCallback& onRead) override;
+
+        virtual FileReaderBackend GetBackend() const override
+        {
+            return FileReaderBackend::Blocking;
+        }
+    };
+
+#ifdef LINA_HEADER_IO_URING
+    class UringFileReader : public FileReader
+    {
+    public:
+        UringFileReader() = default;
+        virtual ~UringFileReader();
+
+        bool         Initialize(unsigned int queueDepth);
+        virtual void ReadFiles(const std::vector<std::string>& paths, const ReadCallback& onRead) override;
+
+        virtual FileReaderBackend GetBackend() const override
+        {
+            return FileReaderBackend::Uring;
+        }
+
+    private:
+        struct Request
+        {
+            size_t      m_index  = 0;
+            int         m_fd     = -1;
+            int         m_stage  = 0;
+            size_t      m_offset = 0;
+            std::string m_content;
+        };
+
+        void* GetSubmissionEntry();
+        void  Submit(unsigned int waitCount);
+        void  QueueOpen(Request& request, const std::string& path, unsigned long long userData);
+        void  QueueRead(Request& request, unsigned long long userData);
+        void  QueueClose(Request& request, unsigned long long userData);
+
+    private:
+        int           m_ringFd     = -1;
+        unsigned int  m_queueDepth = 0;
+        unsigned int  m_toSubmit   = 0;
+        void*         m_sqRing     = nullptr;
+        void*         m_cqRing     = nullptr;
+        void*         m_sqes       = nullptr;
+        size_t        m_sqRingSize = 0;
+        size_t        m_cqRingSize = 0;
+        size_t        m_sqesSize   = 0;
+        unsigned int* m_sqHead     = nullptr;
+        unsigned int* m_sqTail     = nullptr;
+        unsigned int* m_sqMask     = nullptr;
+        unsigned int* m_sqArray    = nullptr;
+        unsigned int* m_cqHead     = nullptr;
+        unsigned int* m_cqTail     = nullptr;
+        unsigned int* m_cqMask     = nullptr;
+        void*         m_cqes       = nullptr;
+    };
+#endif
+} // namespace Lina
+
+#endif
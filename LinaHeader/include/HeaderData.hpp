@@ -0,0 +1,103 @@
+/*
+This file is a part of: Lina Engine
+https://github.com/inanevin/LinaEngine
+
+Author: Inan Evin
+http://www.inanevin.com
+
+Copyright (c) [2018-2020] [Inan Evin]
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+/*
+Class: HeaderData
+
+Reflection data read from the headers. A LinaHeaderData holds everything parsed out of a single
+header and only depends on the header's content, the path & include of each type are filled
+in when the data is added to the tool.
+
+Timestamp: 10/18/2026 11:40:12 AM
+*/
+
+#pragma once
+
+#ifndef HeaderData_HPP
+#define HeaderData_HPP
+
+#include <string>
+#include <vector>
+
+// Bump whenever the parser's output changes, cached parse results of other versions are ignored.
+#define LINA_HEADER_TOOL_VERSION 7
+
+namespace Lina
+{
+    struct LinaProperty
+    {
+        std::string m_title        = "";
+        std::string m_type         = "";
+        std::string m_tooltip      = "";
+        std::string m_dependsOn    = "";
+        std::string m_propertyName = "";
+        std::string m_memberType   = ""; // C++ type of the member as declared, e.g. "float".
+        std::string m_range        = ""; // "min, max, precision", empty if the property has no range.
+    };
+
+    struct LinaComponent
+    {
+        std::string               m_hppPath              = "";
+        std::string               m_hppInclude           = "";
+        std::string               m_name                 = "";
+        std::string               m_nameWithNamespace    = "";
+        std::string               m_title                = "";
+        std::string               m_icon                 = "";
+        std::string               m_category             = "";
+        bool                      m_canAddComponent      = false;
+        bool                      m_listenToValueChanged = false;
+        bool                      m_isStruct             = false;
+        std::vector<std::string>  m_bases;
+        std::vector<LinaProperty> m_properties;
+    };
+
+    struct LinaClass
+    {
+        std::string               m_hppPath           = "";
+        std::string               m_hppInclude        = "";
+        std::string               m_name              = "";
+        std::string               m_nameWithNamespace = "";
+        std::string               m_title             = "";
+        std::vector<std::string>  m_bases;
+        std::vector<LinaProperty> m_properties;
+    };
+
+    struct LinaHeaderFile
+    {
+        std::string m_path    = "";
+        std::string m_include = "";
+    };
+
+    struct LinaHeaderData
+    {
+        std::vector<LinaComponent> m_components;
+        std::vector<LinaClass>     m_classes;
+    };
+} // namespace Lina
+
+#endif
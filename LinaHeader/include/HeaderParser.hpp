@@ -0,0 +1,84 @@
+/*
+This file is a part of: Lina Engine
+https://github.com/inanevin/LinaEngine
+
+Author: Inan Evin
+http://www.inanevin.com
+
+Copyright (c) [2018-2020] [Inan Evin]
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+/*
+Class: HeaderParser
+
+Turns the content of a single header into its reflected components & classes. Everything a parse
+keeps track of, e.g. the current namespace & the macro waiting for its declaration, lives in the
+parser, so headers can be parsed on several threads at once with a parser per thread.
+
+Timestamp: 10/18/2026 4:41:12 PM
+*/
+
+#pragma once
+
+#ifndef HeaderParser_HPP
+#define HeaderParser_HPP
+
+#include "HeaderData.hpp"
+#include <string>
+#include <vector>
+
+namespace Lina
+{
+    class HeaderParser
+    {
+    public:
+        HeaderParser()  = default;
+        ~HeaderParser() = default;
+
+        void Parse(const std::string& content, LinaHeaderData& data);
+
+        static void RemoveWordFromLine(std::string& line, const std::string& word);
+        static void RemoveWhitespaces(std::string& str);
+        static void RemoveWhitespacesPreAndPost(std::string& str);
+        static void RemoveComma(std::string& str);
+        static void RemoveDoubleQuote(std::string& str);
+        static void RemoveString(std::string& str, const std::string& toErase);
+        static void RemoveBrackets(std::string& str);
+
+    private:
+        void                     ProcessPropertyMacro(const std::string& line);
+        void                     ProcessComponentMacro(const std::string& line);
+        void                     ProcessClassMacro(const std::string& line);
+        std::vector<std::string> ProcessBaseClause(const std::string& line);
+
+    private:
+        std::string   m_lastNamespace = "";
+        LinaProperty  m_lastProperty;
+        LinaComponent m_lastComponentData;
+        LinaClass     m_lastClassData;
+        bool          nextLineIsComponent      = false;
+        bool          nextLineIsClass          = false;
+        bool          nextLineIsProperty       = false;
+        bool          m_lastHeaderWasComponent = false;
+    };
+} // namespace Lina
+
+#endif
@@ -38,40 +38,39 @@ Timestamp: 12/14/2021 2:03:29 PM
 
 #ifndef HeaderTool_HPP
 #define HeaderTool_HPP
+#include "FileReader.hpp"
+#include "HeaderData.hpp"
+#include "JobServer.hpp"
+#include "ParseCache.hpp"
+#include "StringPool.hpp"
+#include <cstdint>
+#include <map>
+#include <ostream>
+#include <set>
 #include <string>
 #include <unordered_map>
+#include <unordered_set>
+#include <vector>
 
 namespace Lina
 {
-    struct LinaProperty
+    /// <summary>
+    /// A set of header roots whose reflected types are written into one registry.
+    /// Roots are stored as absolute, '/' separated paths ending with a '/'.
+    /// </summary>
+    struct LinaModule
     {
-        std::string m_title        = "";
-        std::string m_type         = "";
-        std::string m_tooltip      = "";
-        std::string m_dependsOn    = "";
-        std::string m_propertyName = "";
-    };
-
-    struct LinaComponent
-    {
-        std::string               m_hppInclude           = "";
-        std::string               m_name                 = "";
-        std::string               m_nameWithNamespace    = "";
-        std::string               m_title                = "";
-        std::string               m_icon                 = "";
-        std::string               m_category             = "";
-        bool                      m_canAddComponent      = false;
-        bool                      m_listenToValueChanged = false;
-        std::vector<LinaProperty> m_properties;
-    };
-
-    struct LinaClass
-    {
-        std::string               m_hppInclude        = "";
-        std::string               m_name              = "";
-        std::string               m_nameWithNamespace = "";
-        std::string               m_title             = "";
-        std::vector<LinaProperty> m_properties;
+        std::string              m_name         = "";
+        std::vector<std::string> m_roots;
+        std::string              m_registryPath = "";
+        std::string              m_databasePath = "";
+        std::string              m_pchPath      = "";
+        std::string              m_headerPath   = "";
+        std::string              m_idsPath      = "";
+        std::string              m_layoutPath   = "";
+
+        // Type name -> maximum sizeof in bytes, checked by the layout report.
+        std::map<std::string, uint64_t> m_layoutBudgets;
     };
 
     class HeaderTool
@@ -80,35 +79,134 @@ namespace Lina
         HeaderTool() = default;
         ~HeaderTool();
 
-        void Run(const std::string& path);
-        void ReadHPP(const std::string& hpp);
-        void RemoveWordFromLine(std::string& line, const std::string& word);
-        void ProcessPropertyMacro(const std::string& line);
-        void ProcessComponentMacro(const std::string& line);
-        void ProcessClassMacro(const std::string& line);
-        void RemoveWhitespaces(std::string& str);
-        void RemoveWhitespacesPreAndPost(std::string& str);
-        void RemoveComma(std::string& str);
-        void RemoveDoubleQuote(std::string& str);
-        void RemoveString(std::string& str, const std::string& toErase);
-        void RemoveBrackets(std::string& str);
-        void SerializeReadData();
+        bool IsBenchmarkingIO() const
+        {
+            return m_ioBenchmarkRuns > 0;
+        }
+
+        const std::vector<LinaModule>& GetModules() const
+        {
+            return m_modules;
+        }
+
+        const std::unordered_map<std::string, LinaComponent*>& GetComponents() const
+        {
+            return m_componentData;
+        }
+
+        const std::unordered_map<std::string, LinaClass*>& GetClasses() const
+        {
+            return m_classData;
+        }
+
+        /// <summary>
+        /// Properties of a reflected type including those of its reflected bases, base-most first & in declaration order.
+        /// </summary>
+        const std::vector<LinaProperty>& GetFlatProperties(const std::string& nameWithNamespace) const;
+
+        /// <summary>
+        /// In-process setup, used instead of ReadCommandLine when the tool is embedded e.g. in the editor.
+        /// Relative roots & outputs are resolved against the working directory.
+        /// </summary>
+        void AddModule(const LinaModule& module);
+        void SetCache(const std::string& directory, uint64_t sizeMB);
+        void SetIOBackend(FileReaderBackend backend);
+
+        /// <summary>
+        /// Maximum number of parse workers, 0 for one per core. A jobserver in MAKEFLAGS limits them further.
+        /// </summary>
+        void SetJobs(unsigned int jobs);
+
+        /// <summary>
+        /// Re-parses the given headers after a full Run(), headers that were deleted drop their types and
+        /// new headers under a module root are added. Returns true if any header's content changed, in which
+        /// case Serialize() brings the outputs up to date.
+        /// </summary>
+        bool UpdateFiles(const std::vector<std::string>& paths);
+
+        bool ReadCommandLine(int argc, char** argv);
+        bool ReadConfig(const std::string& path);
+        void Run();
+        void Serialize();
+        void Clear();
+        void BenchmarkIO();
+        void ScanRoots();
+        void ScanDirectory(const std::string& path);
+        bool ReadHeaderFiles(const std::vector<LinaHeaderFile>& headerFiles);
+        bool IsHeaderChanged(const LinaHeaderFile& headerFile, const std::string& content);
+        void LoadHPP(const std::string& content, LinaHeaderData& data);
+        void ParseHPP(const std::string& content, LinaHeaderData& data) const;
+        void AddHeaderData(const LinaHeaderFile& headerFile, const LinaHeaderData& data);
+        bool RemoveHeaderData(const std::string& hppPath);
+        void ResolveInheritance();
+        void SerializeReadData(const LinaModule& module);
+        void SerializeDatabase(const LinaModule& module);
+        void SerializePCH(const LinaModule& module);
+        void SerializeComponentHeader(const LinaModule& module);
+        void SerializeLayoutReport(const LinaModule& module);
+        void AssignComponentIDs(const LinaModule& module);
+        void WriteIncludes(const LinaModule& module, std::ostream& out);
+        void WriteRegisterFunction(const LinaModule& module, bool perType, std::ostream& out);
+        void WriteTypeFunctions(const LinaModule& module, std::ostream& out);
+        void WriteComponentMeta(const LinaComponent& componentData, std::ostream& out);
+        void WriteClassMeta(const LinaClass& classData, std::ostream& out);
+        void WriteProperty(const std::string& className, const LinaProperty& property, std::ostream& out);
+        void WriteProps(const std::string& runtimeProps, const std::string& editorProps, std::ostream& out);
+        void WriteStringPool(const LinaModule& module, std::ostream& out);
+        void AddMetaString(const std::string& str);
+        void WriteComponentFunctions(const LinaModule& module, std::ostream& out);
+        void WriteReflectedProperties(const std::string& className, std::ostream& out);
+        void WriteBulkKernels(const std::string& className, std::ostream& out);
+        void WriteDeltaCodec(const std::string& className, std::ostream& out);
+        void WriteQuantizedFields(const std::string& className, std::ostream& out);
+        void ReplaceIfChanged(const std::string& tempPath, const std::string& path);
+        void WriteIfChanged(const std::string& contents, const std::string& path);
+
+    private:
+        bool                        AddOption(const std::string& key, const std::string& value, const std::string& baseDir);
+        bool                        IsInModule(const std::string& hppPath, const LinaModule& module);
+        std::set<std::string>       GetModuleIncludes(const LinaModule& module);
+        std::vector<LinaComponent*> GetModuleComponents(const LinaModule& module);
+        std::vector<LinaClass*>     GetModuleClasses(const LinaModule& module);
+        std::string                 NormalizeRoot(const std::string& path);
+        unsigned int                GetWorkerLimit() const;
+        bool                        IsExcludedDirectory(const std::string& name);
+        bool                        IsReflectedHeader(const std::string& hppPath);
+        LinaHeaderFile              CreateHeaderFile(const std::string& hppPath);
+        std::string                 GetFunctionName(const std::string& nameWithNamespace);
+        std::string                 GetModuleNamespace(const LinaModule& module);
+        bool                        IsNumericProperty(const LinaProperty& property);
+        bool                        GetQuantization(const std::string& className, const LinaProperty& property, double& min, double& max, uint32_t& bits, bool report);
+        bool                        IsQuantizedInSections(const std::string& className, const LinaProperty& property);
+        bool                        IsPooledClass(const LinaClass& classData);
+        std::vector<LinaClass*>     GetPooledClasses(const LinaModule& module);
+        std::string                 FormatDouble(double value);
+        uint32_t                    GetSchemaHash(const std::string& className);
+        std::string                 GetSectionArguments(const std::string& className);
+        std::string                 GetMetaString(const std::string& str);
+        std::string                 ResolveBaseName(const std::string& derived, const std::string& base);
+
+        const std::vector<LinaProperty>& FlattenProperties(const std::string& nameWithNamespace, std::unordered_set<std::string>& visiting);
 
     private:
+        std::vector<LinaModule>                                      m_modules;
+        std::vector<LinaComponent*>                                  m_componentIDs;
+        std::unordered_set<std::string>                              m_visitedHeaders;
+        std::vector<LinaHeaderFile>                                  m_headerFiles;
         std::unordered_map<std::string, LinaComponent*>              m_componentData;
         std::unordered_map<std::string, LinaClass*>                  m_classData;
-        std::unordered_map<std::string, std::vector<LinaComponent*>> m_namespaceComponentMap;
-        std::unordered_map<std::string, std::vector<LinaClass*>>     m_namespaceClassMap;
-        std::string                                                  m_lastClass      = "";
-        std::string                                                  m_lastNamespace  = "";
-        std::string                                                  m_lastHPPInclude = "";
-        LinaProperty                                                 m_lastProperty;
-        LinaComponent                                                m_lastComponentData;
-        LinaClass                                                    m_lastClassData;
-        bool                                                         nextLineIsComponent      = false;
-        bool                                                         nextLineIsClass          = false;
-        bool                                                         nextLineIsProperty       = false;
-        bool                                                         m_lastHeaderWasComponent = false;
+        std::unordered_map<std::string, std::vector<LinaProperty>>   m_flatProperties;
+        std::unordered_map<std::string, uint64_t>                    m_headerHashes;
+        ParseCache                                                   m_parseCache;
+        JobServer                                                    m_jobServer;
+        StringPool                                                   m_metaStrings;
+        std::string                                                  m_cacheDirectory  = "";
+        uint64_t                                                     m_cacheSizeMB     = 256;
+        FileReaderBackend                                            m_ioBackend       = FileReaderBackend::Blocking;
+        int                                                          m_ioBenchmarkRuns = 0;
+        unsigned int                                                 m_jobs            = 0;
+        bool                                                         m_editorPropsMacro       = false;
+        bool                                                         m_perType                = false;
     };
 } // namespace Lina
 
@@ -0,0 +1,137 @@
+/*
+This file is a part of: Lina Engine
+https://github.com/inanevin/LinaEngine
+
+Author: Inan Evin
+http://www.inanevin.com
+
+Copyright (c) [2018-2020] [Inan Evin]
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+/*
+Class: JobServer
+
+Client side of the GNU make jobserver, which Ninja implements as well. A build running the tool as
+a pre-build step passes the jobserver in MAKEFLAGS, either as a named fifo (--jobserver-auth=fifo:PATH),
+as inherited pipe descriptors (--jobserver-auth=R,W or the older --jobserver-fds=R,W) or, on Windows,
+as a named semaphore. Each byte read from it is a token allowing one more job to run; the process
+itself implicitly holds one token. WorkerPool runs the parse workers of the tool, the first one on the
+implicit token & every other one only while it holds a token of its own, so the tool never runs more
+threads than the build allows.
+
+Timestamp: 10/18/2026 4:58:26 PM
+*/
+
+#pragma once
+
+#ifndef JobServer_HPP
+#define JobServer_HPP
+
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace Lina
+{
+    enum class JobServerState
+    {
+        Unchecked,
+        None,      // No jobserver, workers are only limited by their count.
+        Connected, // Tokens are read from & written back to the jobserver.
+        Unusable,  // A jobserver was given but can not be used, only the implicit token is available.
+    };
+
+    class JobServer
+    {
+    public:
+        JobServer() = default;
+        ~JobServer();
+
+        JobServer(const JobServer&)            = delete;
+        JobServer& operator=(const JobServer&) = delete;
+
+        /// <summary>
+        /// Connects to the jobserver given in MAKEFLAGS, does nothing after the first call.
+        /// </summary>
+        JobServerState Connect();
+
+        /// <summary>
+        /// Waits up to timeoutMs for a token, always succeeds without a jobserver. Acquired tokens are
+        /// handed back through Release.
+        /// </summary>
+        bool Acquire(int timeoutMs, char& token);
+        void Release(char token);
+
+        JobServerState GetState() const
+        {
+            return m_state;
+        }
+
+    private:
+        bool ConnectAuth(const std::string& auth);
+
+    private:
+        JobServerState m_state = JobServerState::Unchecked;
+#ifdef _WIN32
+        void* m_semaphore = nullptr;
+#else
+        int m_readFd  = -1;
+        int m_writeFd = -1;
+#endif
+    };
+
+    class WorkerPool
+    {
+    public:
+        typedef std::function<void(size_t index)> Job;
+
+        /// <summary>
+        /// Starts threadCount workers running job for every pushed index, in any order & on any worker.
+        /// </summary>
+        WorkerPool(JobServer& jobServer, unsigned int threadCount, const Job& job);
+        ~WorkerPool();
+
+        void Push(size_t index);
+
+        /// <summary>
+        /// Waits for every pushed job to complete & stops the workers.
+        /// </summary>
+        void Finish();
+
+    private:
+        void Work(bool implicitToken);
+
+    private:
+        JobServer&               m_jobServer;
+        Job                      m_job;
+        std::vector<std::thread> m_threads;
+        std::deque<size_t>       m_queue;
+        std::mutex               m_mutex;
+        std::condition_variable  m_condition;
+        bool                     m_finished = false;
+    };
+} // namespace Lina
+
+#endif
@@ -0,0 +1,86 @@
+/*
+This file is a part of: Lina Engine
+https://github.com/inanevin/LinaEngine
+
+Author: Inan Evin
+http://www.inanevin.com
+
+Copyright (c) [2018-2020] [Inan Evin]
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+/*
+Class: ParseCache
+
+Optional, content addressed store of parse results shared by every build directory & branch
+on the machine, similar to ccache. Entries are keyed by a hash of the header content and the
+tool version, so they never need invalidation. Each entry is written to a temporary file and
+renamed into place, readers therefore only ever see complete entries & parallel builds can
+share the same store. The store is trimmed to its size limit by evicting the least recently
+used entries, a hit refreshes the entry's modification time. Load & Store may be called by several
+parse workers at once.
+
+Timestamp: 10/18/2026 11:52:37 AM
+*/
+
+#pragma once
+
+#ifndef ParseCache_HPP
+#define ParseCache_HPP
+
+#include "HeaderData.hpp"
+#include <atomic>
+#include <cstdint>
+#include <string>
+
+namespace Lina
+{
+    class ParseCache
+    {
+    public:
+        ParseCache() = default;
+        ~ParseCache() = default;
+
+        void Open(const std::string& directory, uint64_t maxSize);
+        void Trim();
+        bool Load(uint64_t key, const std::string& content, LinaHeaderData& data);
+        void Store(uint64_t key, const std::string& content, const LinaHeaderData& data);
+
+        bool IsEnabled() const
+        {
+            return !m_directory.empty();
+        }
+
+        static uint64_t    GetKey(const std::string& content);
+        static std::string GetDefaultDirectory();
+
+    private:
+        std::string GetEntryPath(uint64_t key);
+
+    private:
+        std::string           m_directory     = "";
+        uint64_t              m_maxSize       = 0;
+        uint64_t              m_nonce         = 0;
+        std::atomic<uint32_t> m_tempCounter   = 0;
+        std::atomic<bool>     m_storedEntries = false;
+    };
+} // namespace Lina
+
+#endif
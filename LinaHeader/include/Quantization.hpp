@@ -0,0 +1,61 @@
+/*
+This file is a part of: Lina Engine
+https://github.com/inanevin/LinaEngine
+
+Author: Inan Evin
+http://www.inanevin.com
+
+Copyright (c) [2018-2020] [Inan Evin]
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+/*
+Class: Quantization
+
+Parses the "min, max, precision" range of a LINA_PROPERTY & picks the fewest bits that keep
+decoded values within precision of the original, see QuantizeValue & DequantizeValue in
+ReflectedTypeTable.hpp for the runtime side.
+
+Timestamp: 10/18/2026 9:41:12 PM
+*/
+
+#pragma once
+
+#ifndef Quantization_HPP
+#define Quantization_HPP
+
+#include <cstdint>
+#include <string>
+
+namespace Lina
+{
+    /// <summary>
+    /// Parses exactly three comma separated numbers, whitespace around them is allowed. Returns false & describes
+    /// what is wrong in error if the range is malformed, min is not below max or precision is not positive.
+    /// </summary>
+    bool ParseQuantizationRange(const std::string& range, double& min, double& max, double& precision, std::string& error);
+
+    /// <summary>
+    /// Fewest bits such that half a step, (max - min) / (2 * (2^bits - 1)), is within precision. 0 if that needs more than 32 bits.
+    /// </summary>
+    uint32_t GetQuantizationBits(double min, double max, double precision);
+} // namespace Lina
+
+#endif
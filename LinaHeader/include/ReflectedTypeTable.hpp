@@ -0,0 +1,418 @@
+/*
+This file is a part of: Lina Engine
+https://github.com/inanevin/LinaEngine
+
+Author: Inan Evin
+http://www.inanevin.com
+
+Copyright (c) [2018-2020] [Inan Evin]
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+/*
+Class: ReflectedTypeTable
+
+Per-type registration entry points of a generated reflection registry. Besides registering
+everything in RegisterReflectedComponents, the registry defines a Register_X & Unregister_X
+function for every reflected type X (namespace separators replaced by '_') and a table of
+them, sorted by the hash of the type's full name. After a hot reload only the types declared
+in the changed headers need to be reset & registered again, instead of the whole meta graph.
+
+Every entry tracks whether its type is currently registered. Built with LINA_REFLECTION_LAZY,
+RegisterReflectedComponents registers nothing and each type is registered on first use through
+EnsureRegistered<T>() or EnsureRegistered(hash), so startup only pays for what is used. Like the
+rest of the meta graph, registration is expected to happen on a single thread.
+
+GetReflectedProperties<T>() returns every property of T, inherited ones included, sorted by
+their offset within T, so inspectors & serializers can walk a component in a single pass.
+
+GetReflectedBulkKernels<T>() returns, for every numeric property of component T, functions
+applying one operation to that property on all instances in T's storage, e.g. scaling the
+intensity of every light, without going through meta get/set per entity. The kernels write the
+storage directly & emit no on_update signals, callers with observers patch the entities after.
+
+GetReflectedDeltaCodec<T>() encodes the difference between two instances of component T as a
+bitmask of the changed properties followed by their new values, and applies such a delta onto
+an instance equal to the baseline, e.g. for replay recording & undo.
+
+GetReflectedQuantizedFields<T>() lists the floating point properties of component T that declare
+a range in their LINA_PROPERTY, along with the bits needed to store them within the declared
+precision. EncodeQuantized & DecodeQuantized bit-pack those fields of an instance.
+
+ReflectedMemoryStats describes the live pool of a component, or of a reflected class deriving
+from ECS::Component, see the "memstats" meta func & SampleReflectedMemoryStats in the generated
+component header.
+
+ReflectedSectionResult tells what deserializing a serialized component section did with it, see
+LoadReflectedSection in the generated component header.
+
+Hashes are 32 bit FNV-1a, the same as entt's hashed strings, so an entry's hash equals
+"ECS::LightComponent"_hs. The generated symbols of a module live in a namespace named after it,
+e.g. Lina::LinaEngineReflection, so the registries of several modules can be linked together.
+
+Timestamp: 10/18/2026 7:12:40 PM
+*/
+
+#pragma once
+
+#ifndef ReflectedTypeTable_HPP
+#define ReflectedTypeTable_HPP
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <limits>
+#include <vector>
+
+namespace Lina
+{
+    typedef void (*ReflectedTypeFunction)();
+
+    struct ReflectedTypeEntry
+    {
+        uint32_t              m_hash         = 0;
+        const char*           m_name         = nullptr;
+        const char*           m_include      = nullptr;
+        ReflectedTypeFunction m_register     = nullptr;
+        ReflectedTypeFunction m_unregister   = nullptr;
+        bool                  m_isRegistered = false;
+    };
+
+    struct ReflectedProperty
+    {
+        uint32_t m_hash   = 0; // Hash of the member's name, the id of its entt meta data.
+        uint32_t m_offset = 0;
+        uint32_t m_size   = 0;
+    };
+
+    // Set, add, scale & clamp write the storage without emitting on_update signals.
+    struct ReflectedBulkKernels
+    {
+        uint32_t m_hash                            = 0; // Hash of the member's name.
+        void (*m_set)(double value)                = nullptr;
+        void (*m_add)(double value)                = nullptr;
+        void (*m_scale)(double factor)             = nullptr;
+        void (*m_clamp)(double min, double max)    = nullptr;
+        bool (*m_minMax)(double& min, double& max) = nullptr; // False if there are no instances.
+    };
+
+    struct ReflectedDeltaCodec
+    {
+        uint32_t m_fieldCount = 0; // Bits in the mask, m_isEnabled followed by the properties in declaration order.
+
+        // Appends the mask & the values of the fields that differ between the instances, appends nothing & returns false if none does.
+        bool (*m_encode)(const void* baseline, const void* current, std::vector<uint8_t>& out) = nullptr;
+
+        // Applies a delta onto target, returns the bytes it took up or 0 if it is truncated.
+        size_t (*m_decode)(const uint8_t* data, size_t size, void* target) = nullptr;
+    };
+
+    enum class ReflectedSectionResult : uint8_t
+    {
+        Loaded,        // Decoded into the registry.
+        OtherType,     // Written for another component, left in the stream.
+        SchemaChanged, // Written with another schema of the component, skipped.
+        Unknown,       // No reflected component has the section's type hash, skipped.
+    };
+
+    struct ReflectedMemoryStats
+    {
+        size_t m_instanceCount    = 0;
+        size_t m_instanceSize     = 0; // sizeof(T)
+        size_t m_capacity         = 0; // Instances the storage has room for without growing.
+        size_t m_storageBytes     = 0; // m_capacity * m_instanceSize
+        size_t m_ownedHeapBytes   = 0; // Estimated heap owned by the instances, e.g. strings & containers.
+        size_t m_ownedHeapSamples = 0; // Instances the heap estimate was measured on, m_instanceCount if it is exact.
+    };
+
+    struct ReflectedQuantizedField
+    {
+        uint32_t m_hash = 0; // Hash of the member's name.
+        double   m_min  = 0.0;
+        double   m_max  = 0.0;
+        uint32_t m_bits = 0; // Values are stored as one of the 2^bits evenly spaced steps between min & max.
+
+        // Values outside of the range are clamped, NaN is stored as min.
+        uint32_t (*m_quantize)(const void* instance, const ReflectedQuantizedField& field)        = nullptr;
+        void (*m_dequantize)(void* instance, uint32_t value, const ReflectedQuantizedField& field) = nullptr;
+    };
+
+    /// <summary>
+    /// Largest difference between a value within the field's range & its decoded value: half a step, plus a few units in the
+    /// last place of the range's bounds for the rounding of the double arithmetic, e.g. for values exactly between two steps.
+    /// Converting the result back to the member's type adds at most half a unit in the last place of that type.
+    /// </summary>
+    inline double GetQuantizationError(const ReflectedQuantizedField& field)
+    {
+        const double magnitude = std::max(std::fabs(field.m_min), std::fabs(field.m_max));
+        return (field.m_max - field.m_min) / (2.0 * static_cast<double>((uint64_t(1) << field.m_bits) - 1)) + 8.0 * std::numeric_limits<double>::epsilon() * magnitude;
+    }
+
+    /// <summary>
+    /// Index of the step closest to value. Values outside of the range are clamped, NaN is stored as min.
+    /// </summary>
+    inline uint32_t QuantizeValue(double value, const ReflectedQuantizedField& field)
+    {
+        const double steps = static_cast<double>((uint64_t(1) << field.m_bits) - 1);
+        const double clamp = value > field.m_max ? field.m_max : (value >= field.m_min ? value : field.m_min);
+        return static_cast<uint32_t>((clamp - field.m_min) / (field.m_max - field.m_min) * steps + 0.5);
+    }
+
+    inline double DequantizeValue(uint32_t value, const ReflectedQuantizedField& field)
+    {
+        const double steps = static_cast<double>((uint64_t(1) << field.m_bits) - 1);
+        return field.m_min + (field.m_max - field.m_min) * (static_cast<double>(value) / steps);
+    }
+
+    class ReflectedBitWriter
+    {
+    public:
+        explicit ReflectedBitWriter(std::vector<uint8_t>& out) : m_out(out)
+        {
+        }
+
+        ~ReflectedBitWriter()
+        {
+            Flush();
+        }
+
+        void Write(uint32_t value, uint32_t bits)
+        {
+            m_pending |= static_cast<uint64_t>(value) << m_pendingBits;
+            m_pendingBits += bits;
+
+            while (m_pendingBits >= 8)
+            {
+                m_out.push_back(static_cast<uint8_t>(m_pending));
+                m_pending >>= 8;
+                m_pendingBits -= 8;
+            }
+        }
+
+        // Writes out the last partial byte, zero padded.
+        void Flush()
+        {
+            if (m_pendingBits > 0)
+                m_out.push_back(static_cast<uint8_t>(m_pending));
+
+            m_pending     = 0;
+            m_pendingBits = 0;
+        }
+
+    private:
+        std::vector<uint8_t>& m_out;
+        uint64_t              m_pending     = 0;
+        uint32_t              m_pendingBits = 0;
+    };
+
+    class ReflectedBitReader
+    {
+    public:
+        ReflectedBitReader(const uint8_t* data, size_t size) : m_data(data), m_size(size)
+        {
+        }
+
+        bool Read(uint32_t bits, uint32_t& value)
+        {
+            while (m_pendingBits < bits)
+            {
+                if (m_offset == m_size)
+                    return false;
+
+                m_pending |= static_cast<uint64_t>(m_data[m_offset++]) << m_pendingBits;
+                m_pendingBits += 8;
+            }
+
+            value = static_cast<uint32_t>(m_pending & ((uint64_t(1) << bits) - 1));
+            m_pending >>= bits;
+            m_pendingBits -= bits;
+            return true;
+        }
+
+        // Bytes consumed so far, including a partially read one.
+        size_t GetOffset() const
+        {
+            return m_offset;
+        }
+
+    private:
+        const uint8_t* m_data        = nullptr;
+        size_t         m_size        = 0;
+        size_t         m_offset      = 0;
+        uint64_t       m_pending     = 0;
+        uint32_t       m_pendingBits = 0;
+    };
+
+    /// <summary>
+    /// Specialized by the generated registry for every reflected type, registers T unless it already is.
+    /// </summary>
+    template <typename T>
+    void EnsureRegistered();
+
+    /// <summary>
+    /// Specialized by the generated registry for every reflected type, returns its properties in offset order.
+    /// </summary>
+    template <typename T>
+    const ReflectedProperty* GetReflectedProperties(uint32_t& count);
+
+    /// <summary>
+    /// Specialized by the generated registry for every reflected component, returns the kernels of its numeric properties.
+    /// </summary>
+    template <typename T>
+    const ReflectedBulkKernels* GetReflectedBulkKernels(uint32_t& count);
+
+    /// <summary>
+    /// Specialized by the generated registry for every reflected component. Values are copied bytewise
+    /// in the native layout, deltas are meant for the running process or a replay of the same build.
+    /// </summary>
+    template <typename T>
+    const ReflectedDeltaCodec* GetReflectedDeltaCodec();
+
+    /// <summary>
+    /// Specialized by the generated registry for every reflected component, returns its fields with a declared range.
+    /// </summary>
+    template <typename T>
+    const ReflectedQuantizedField* GetReflectedQuantizedFields(uint32_t& count);
+
+    inline void EncodeQuantized(const ReflectedQuantizedField* fields, uint32_t count, const void* instance, ReflectedBitWriter& writer)
+    {
+        for (uint32_t i = 0; i < count; i++)
+            writer.Write(fields[i].m_quantize(instance, fields[i]), fields[i].m_bits);
+    }
+
+    inline bool DecodeQuantized(const ReflectedQuantizedField* fields, uint32_t count, void* instance, ReflectedBitReader& reader)
+    {
+        for (uint32_t i = 0; i < count; i++)
+        {
+            uint32_t value = 0;
+            if (!reader.Read(fields[i].m_bits, value))
+                return false;
+
+            fields[i].m_dequantize(instance, value, fields[i]);
+        }
+
+        return true;
+    }
+
+    /// <summary>
+    /// The helpers below work on the table of one module, see GetReflectedTypes in its generated component header,
+    /// which also wraps them for that module's table.
+    /// </summary>
+    inline ReflectedTypeEntry* FindReflectedType(ReflectedTypeEntry* entries, uint32_t total, uint32_t hash)
+    {
+        uint32_t first = 0;
+        uint32_t count = total;
+
+        while (count > 0)
+        {
+            const uint32_t half = count / 2;
+            if (entries[first + half].m_hash < hash)
+            {
+                first += half + 1;
+                count -= half + 1;
+            }
+            else
+                count = half;
+        }
+
+        return first < total && entries[first].m_hash == hash ? &entries[first] : nullptr;
+    }
+
+    inline void EnsureRegistered(ReflectedTypeEntry& entry)
+    {
+        if (entry.m_isRegistered)
+            return;
+
+        entry.m_register();
+        entry.m_isRegistered = true;
+    }
+
+    inline void Unregister(ReflectedTypeEntry& entry)
+    {
+        if (!entry.m_isRegistered)
+            return;
+
+        entry.m_unregister();
+        entry.m_isRegistered = false;
+    }
+
+    /// <summary>
+    /// Hashed-id lookup, registers the type with the given name hash on first use.
+    /// </summary>
+    inline bool EnsureRegistered(ReflectedTypeEntry* entries, uint32_t count, uint32_t hash)
+    {
+        ReflectedTypeEntry* entry = FindReflectedType(entries, count, hash);
+        if (entry == nullptr)
+            return false;
+
+        EnsureRegistered(*entry);
+        return true;
+    }
+
+    inline bool UnregisterReflectedType(ReflectedTypeEntry* entries, uint32_t count, uint32_t hash)
+    {
+        ReflectedTypeEntry* entry = FindReflectedType(entries, count, hash);
+        if (entry == nullptr)
+            return false;
+
+        Unregister(*entry);
+        return true;
+    }
+
+    /// <summary>
+    /// Registers every type that is not registered yet, what RegisterReflectedComponents does in eager builds.
+    /// </summary>
+    inline void RegisterReflectedTypes(ReflectedTypeEntry* entries, uint32_t count)
+    {
+        for (uint32_t i = 0; i < count; i++)
+            EnsureRegistered(entries[i]);
+    }
+
+    /// <summary>
+    /// Resets & registers again every registered type declared in the given header, e.g. "Core/LightComponent.hpp"
+    /// as it appears in the registry's includes. Types that were not used yet stay unregistered.
+    /// Returns the number of types that were re-registered.
+    /// </summary>
+    inline uint32_t ReregisterReflectedHeader(ReflectedTypeEntry* entries, uint32_t count, const char* include)
+    {
+        uint32_t affected = 0;
+
+        for (uint32_t i = 0; i < count; i++)
+        {
+            if (entries[i].m_isRegistered && std::strcmp(entries[i].m_include, include) == 0)
+            {
+                entries[i].m_unregister();
+                affected++;
+            }
+        }
+
+        for (uint32_t i = 0; i < count; i++)
+        {
+            if (entries[i].m_isRegistered && std::strcmp(entries[i].m_include, include) == 0)
+                entries[i].m_register();
+        }
+
+        return affected;
+    }
+} // namespace Lina
+
+#endif
@@ -0,0 +1,263 @@
+/*
+This file is a part of: Lina Engine
+https://github.com/inanevin/LinaEngine
+
+Author: Inan Evin
+http://www.inanevin.com
+
+Copyright (c) [2018-2020] [Inan Evin]
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+/*
+Class: ReflectionDatabase
+
+Header-only reader for the binary reflection database (*.linadb) emitted by Lina Header Tool.
+The file is laid out so that it can be used in place right after mapping it into memory,
+no parsing or allocation is done. All offsets are in bytes from the start of the file, all
+tables are 4 byte aligned and strings live in a single null-terminated string pool.
+
+    DatabaseHeader
+    DatabaseType[typeCount]              components then classes, each sorted by full name
+    DatabaseProperty[propertyCount]      grouped by owning type, declaration order
+    DatabaseIndexEntry[typeCount]        type name hashes, sorted by hash
+    DatabaseIndexEntry[propertyCount]    property name hashes, sorted by hash within each type
+    char[stringPoolSize]                 string pool
+
+Names are hashed with 32 bit FNV-1a, the same function entt uses for hashed strings, so a
+property hash equals the "m_name"_hs identifier registered in the meta system.
+
+Timestamp: 10/18/2026 10:26:05 AM
+*/
+
+#pragma once
+
+#ifndef ReflectionDatabase_HPP
+#define ReflectionDatabase_HPP
+
+#include <cstddef>
+#include <cstdint>
+
+#define LINA_REFLECTION_DB_MAGIC   0x42444E4C // LNDB
+#define LINA_REFLECTION_DB_VERSION 1
+
+namespace Lina
+{
+    enum DatabaseTypeFlags : uint32_t
+    {
+        DB_TYPE_COMPONENT              = 1 << 0,
+        DB_TYPE_CAN_ADD_COMPONENT      = 1 << 1,
+        DB_TYPE_LISTEN_TO_VALUE_CHANGE = 1 << 2,
+    };
+
+    struct DatabaseHeader
+    {
+        uint32_t m_magic               = LINA_REFLECTION_DB_MAGIC;
+        uint32_t m_version             = LINA_REFLECTION_DB_VERSION;
+        uint32_t m_fileSize            = 0;
+        uint32_t m_typeCount           = 0;
+        uint32_t m_typeTableOffset     = 0;
+        uint32_t m_propertyCount       = 0;
+        uint32_t m_propertyTableOffset = 0;
+        uint32_t m_typeIndexOffset     = 0;
+        uint32_t m_propertyIndexOffset = 0;
+        uint32_t m_stringPoolOffset    = 0;
+        uint32_t m_stringPoolSize      = 0;
+    };
+
+    struct DatabaseType
+    {
+        uint32_t m_hash              = 0;
+        uint32_t m_name              = 0;
+        uint32_t m_nameWithNamespace = 0;
+        uint32_t m_include           = 0;
+        uint32_t m_title             = 0;
+        uint32_t m_icon              = 0;
+        uint32_t m_category          = 0;
+        uint32_t m_flags             = 0;
+        uint32_t m_firstProperty     = 0;
+        uint32_t m_propertyCount     = 0;
+    };
+
+    struct DatabaseProperty
+    {
+        uint32_t m_hash      = 0;
+        uint32_t m_name      = 0;
+        uint32_t m_title     = 0;
+        uint32_t m_type      = 0;
+        uint32_t m_tooltip   = 0;
+        uint32_t m_dependsOn = 0;
+    };
+
+    struct DatabaseIndexEntry
+    {
+        uint32_t m_hash  = 0;
+        uint32_t m_index = 0;
+    };
+
+    constexpr uint32_t HashDatabaseString(const char* str)
+    {
+        uint32_t hash = 2166136261u;
+        for (; *str != '\0'; str++)
+            hash = (hash ^ static_cast<uint8_t>(*str)) * 16777619u;
+        return hash;
+    }
+
+    class ReflectionDatabase
+    {
+    public:
+        ReflectionDatabase() = default;
+        ~ReflectionDatabase() = default;
+
+        /// <summary>
+        /// Validates the header & table bounds of a mapped database, does not copy anything.
+        /// The memory must stay alive & unchanged as long as this reader is used.
+        /// </summary>
+        bool Open(const void* data, size_t size)
+        {
+            m_data   = nullptr;
+            m_header = nullptr;
+
+            if (data == nullptr || size < sizeof(DatabaseHeader) || reinterpret_cast<uintptr_t>(data) % alignof(DatabaseHeader) != 0)
+                return false;
+
+            const uint8_t*        bytes  = static_cast<const uint8_t*>(data);
+            const DatabaseHeader* header = reinterpret_cast<const DatabaseHeader*>(bytes);
+
+            if (header->m_magic != LINA_REFLECTION_DB_MAGIC || header->m_version != LINA_REFLECTION_DB_VERSION || header->m_fileSize > size)
+                return false;
+
+            const uint64_t fileSize = header->m_fileSize;
+            if (!IsRangeValid(header->m_typeTableOffset, uint64_t(header->m_typeCount) * sizeof(DatabaseType), fileSize) ||
+                !IsRangeValid(header->m_propertyTableOffset, uint64_t(header->m_propertyCount) * sizeof(DatabaseProperty), fileSize) ||
+                !IsRangeValid(header->m_typeIndexOffset, uint64_t(header->m_typeCount) * sizeof(DatabaseIndexEntry), fileSize) ||
+                !IsRangeValid(header->m_propertyIndexOffset, uint64_t(header->m_propertyCount) * sizeof(DatabaseIndexEntry), fileSize) ||
+                !IsRangeValid(header->m_stringPoolOffset, header->m_stringPoolSize, fileSize))
+                return false;
+
+            // Pool must be terminated so that no string lookup can run past it.
+            if (header->m_stringPoolSize == 0 || bytes[header->m_stringPoolOffset + header->m_stringPoolSize - 1] != '\0')
+                return false;
+
+            // Each type's slice of the property table & index, read by GetProperties & FindProperty without further checks.
+            const DatabaseType* types = reinterpret_cast<const DatabaseType*>(bytes + header->m_typeTableOffset);
+            for (uint32_t i = 0; i < header->m_typeCount; i++)
+            {
+                if (uint64_t(types[i].m_firstProperty) + types[i].m_propertyCount > header->m_propertyCount)
+                    return false;
+            }
+
+            m_data   = bytes;
+            m_header = header;
+            return true;
+        }
+
+        bool IsValid() const
+        {
+            return m_header != nullptr;
+        }
+
+        uint32_t GetTypeCount() const
+        {
+            return m_header->m_typeCount;
+        }
+
+        const DatabaseType& GetType(uint32_t index) const
+        {
+            return GetTypes()[index];
+        }
+
+        const DatabaseProperty* GetProperties(const DatabaseType& type) const
+        {
+            return reinterpret_cast<const DatabaseProperty*>(m_data + m_header->m_propertyTableOffset) + type.m_firstProperty;
+        }
+
+        const char* GetString(uint32_t offset) const
+        {
+            if (offset >= m_header->m_stringPoolSize)
+                return "";
+            return reinterpret_cast<const char*>(m_data + m_header->m_stringPoolOffset + offset);
+        }
+
+        /// <summary>
+        /// Finds a type by its full name, e.g. ECS::PointLightComponent, or by its hash.
+        /// </summary>
+        const DatabaseType* FindType(const char* nameWithNamespace) const
+        {
+            return FindType(HashDatabaseString(nameWithNamespace));
+        }
+
+        const DatabaseType* FindType(uint32_t hash) const
+        {
+            const DatabaseIndexEntry* index = reinterpret_cast<const DatabaseIndexEntry*>(m_data + m_header->m_typeIndexOffset);
+            const DatabaseIndexEntry* entry = LowerBound(index, index + m_header->m_typeCount, hash);
+            if (entry == index + m_header->m_typeCount || entry->m_hash != hash || entry->m_index >= m_header->m_typeCount)
+                return nullptr;
+            return &GetTypes()[entry->m_index];
+        }
+
+        /// <summary>
+        /// Finds a property of the given type by its name, e.g. m_intensity, or by its hash.
+        /// </summary>
+        const DatabaseProperty* FindProperty(const DatabaseType& type, const char* name) const
+        {
+            return FindProperty(type, HashDatabaseString(name));
+        }
+
+        const DatabaseProperty* FindProperty(const DatabaseType& type, uint32_t hash) const
+        {
+            const DatabaseIndexEntry* index = reinterpret_cast<const DatabaseIndexEntry*>(m_data + m_header->m_propertyIndexOffset) + type.m_firstProperty;
+            const DatabaseIndexEntry* entry = LowerBound(index, index + type.m_propertyCount, hash);
+            if (entry == index + type.m_propertyCount || entry->m_hash != hash || entry->m_index >= m_header->m_propertyCount)
+                return nullptr;
+            return reinterpret_cast<const DatabaseProperty*>(m_data + m_header->m_propertyTableOffset) + entry->m_index;
+        }
+
+    private:
+        static bool IsRangeValid(uint64_t offset, uint64_t size, uint64_t fileSize)
+        {
+            return offset % 4 == 0 && offset + size <= fileSize;
+        }
+
+        static const DatabaseIndexEntry* LowerBound(const DatabaseIndexEntry* first, const DatabaseIndexEntry* last, uint32_t hash)
+        {
+            while (first < last)
+            {
+                const DatabaseIndexEntry* mid = first + (last - first) / 2;
+                if (mid->m_hash < hash)
+                    first = mid + 1;
+                else
+                    last = mid;
+            }
+            return first;
+        }
+
+        const DatabaseType* GetTypes() const
+        {
+            return reinterpret_cast<const DatabaseType*>(m_data + m_header->m_typeTableOffset);
+        }
+
+    private:
+        const uint8_t*        m_data   = nullptr;
+        const DatabaseHeader* m_header = nullptr;
+    };
+} // namespace Lina
+
+#endif
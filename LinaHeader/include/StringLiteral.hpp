@@ -0,0 +1,65 @@
+/*
+This file is a part of: Lina Engine
+https://github.com/inanevin/LinaEngine
+
+Author: Inan Evin
+http://www.inanevin.com
+
+Copyright (c) [2018-2020] [Inan Evin]
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+/*
+Class: StringLiteral
+
+Reads the string literals of reflection macros into the text they denote & writes text back as a
+literal of the generated code, so quotes, backslashes & control characters survive both ways.
+
+Timestamp: 10/19/2026 11:02:37 AM
+*/
+
+#pragma once
+
+#ifndef StringLiteral_HPP
+#define StringLiteral_HPP
+
+#include <string>
+#include <vector>
+
+namespace Lina
+{
+    /// <summary>
+    /// Collects the string literals of a macro's argument list, e.g. LINA_PROPERTY("Title", "Float", "Tip"), up to its closing
+    /// parenthesis. Parentheses & commas inside a literal do not end it. Escape sequences are resolved.
+    /// </summary>
+    std::vector<std::string> ReadStringLiterals(const std::string& line);
+
+    /// <summary>
+    /// Resolves the escape sequences of a literal's body, the text between its quotes.
+    /// </summary>
+    std::string UnescapeStringLiteral(const std::string& body);
+
+    /// <summary>
+    /// Body of a literal denoting str, without the quotes. Quotes & backslashes are escaped, control characters are written as
+    /// three digit octal escapes so that a following digit is never taken into the escape.
+    /// </summary>
+    std::string EscapeStringLiteral(const std::string& str);
+} // namespace Lina
+
+#endif
@@ -0,0 +1,68 @@
+/*
+This file is a part of: Lina Engine
+https://github.com/inanevin/LinaEngine
+
+Author: Inan Evin
+http://www.inanevin.com
+
+Copyright (c) [2018-2020] [Inan Evin]
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+/*
+Class: StringPool
+
+Deduplicated, contiguous pool of null-terminated strings. Each unique string is stored once
+and referred to by its byte offset within the pool. Offset 0 is always the empty string.
+
+Timestamp: 10/18/2026 10:12:41 AM
+*/
+
+#pragma once
+
+#ifndef StringPool_HPP
+#define StringPool_HPP
+
+#include <cstdint>
+#include <string>
+#include <unordered_map>
+
+namespace Lina
+{
+    class StringPool
+    {
+    public:
+        StringPool();
+        ~StringPool() = default;
+
+        uint32_t Add(const std::string& str);
+
+        const std::string& GetData() const
+        {
+            return m_data;
+        }
+
+    private:
+        std::unordered_map<std::string, uint32_t> m_offsets;
+        std::string                               m_data = "";
+    };
+} // namespace Lina
+
+#endif
@@ -0,0 +1,359 @@
+/*
+This file is a part of: Lina Engine
+https://github.com/inanevin/LinaEngine
+
+Author: Inan Evin
+http://www.inanevin.com
+
+Copyright (c) [2018-2020] [Inan Evin]
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+#include "FileReader.hpp"
+#include <algorithm>
+#include <cerrno>
+#include <cstring>
+#include <fstream>
+#include <iostream>
+
+#ifdef __linux__
+#include <fcntl.h>
+#include <unistd.h>
+#endif
+
+#ifdef LINA_HEADER_IO_URING
+#include <cerrno>
+#include <cstring>
+#include <fcntl.h>
+#include <linux/io_uring.h>
+#include <sys/mman.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
+
+namespace Lina
+{
+
+#define URING_QUEUE_DEPTH 64
+#define URING_READ_CHUNK  64 * 1024
+
+    namespace
+    {
+        bool ReadWholeFile(const std::string& path, std::string& content)
+        {
+            std::ifstream file;
+            file.open(path, std::ifstream::in | std::ifstream::binary);
+
+            if (!file.is_open())
+                return false;
+
+            file.seekg(0, std::ifstream::end);
+            content.resize(static_cast<size_t>(file.tellg()));
+            file.seekg(0, std::ifstream::beg);
+            file.read(&content[0], content.size());
+            return !file.bad();
+        }
+
+        void ReportReadError(const std::string& path, const char* reason)
+        {
+            std::cerr << "Lina Header Tool: could not read " << path << ": " << reason << std::endl;
+        }
+    } // namespace
+
+    std::unique_ptr<FileReader> FileReader::Create(FileReaderBackend backend)
+    {
+#ifdef LINA_HEADER_IO_URING
+        if (backend == FileReaderBackend::Uring)
+        {
+            std::unique_ptr<UringFileReader> reader = std::make_unique<UringFileReader>();
+            if (reader->Initialize(URING_QUEUE_DEPTH))
+                return reader;
+        }
+#endif
+        return std::make_unique<BlockingFileReader>();
+    }
+
+    const char* FileReader::GetBackendName(FileReaderBackend backend)
+    {
+        return backend == FileReaderBackend::Uring ? "uring" : "blocking";
+    }
+
+    bool FileReader::EvictFromPageCache(const std::string& path)
+    {
+#ifdef __linux__
+        const int fd = open(path.c_str(), O_RDONLY | O_CLOEXEC);
+        if (fd < 0)
+            return false;
+
+        const bool evicted = posix_fadvise(fd, 0, 0, POSIX_FADV_DONTNEED) == 0;
+        close(fd);
+        return evicted;
+#else
+        return false;
+#endif
+    }
+
+    void BlockingFileReader::ReadFiles(const std::vector<std::string>& paths, const ReadCallback& onRead)
+    {
+        std::string content;
+
+        for (size_t i = 0; i < paths.size(); i++)
+        {
+            if (ReadWholeFile(paths[i], content))
+                onRead(i, content);
+            else
+                ReportReadError(paths[i], std::strerror(errno));
+        }
+    }
+
+#ifdef LINA_HEADER_IO_URING
+
+#define REQUEST_STAGE_OPEN  0
+#define REQUEST_STAGE_READ  1
+#define REQUEST_STAGE_CLOSE 2
+
+    UringFileReader::~UringFileReader()
+    {
+        if (m_sqes != nullptr)
+            munmap(m_sqes, m_sqesSize);
+
+        if (m_cqRing != nullptr && m_cqRing != m_sqRing)
+            munmap(m_cqRing, m_cqRingSize);
+
+        if (m_sqRing != nullptr)
+            munmap(m_sqRing, m_sqRingSize);
+
+        if (m_ringFd >= 0)
+            close(m_ringFd);
+    }
+
+    bool UringFileReader::Initialize(unsigned int queueDepth)
+    {
+        io_uring_params params;
+        std::memset(&params, 0, sizeof(io_uring_params));
+
+        m_ringFd = static_cast<int>(syscall(__NR_io_uring_setup, queueDepth, &params));
+        if (m_ringFd < 0)
+            return false;
+
+        // Opening, reading & closing through the ring needs 5.6+, older kernels take the blocking path.
+        std::vector<char> probeData(sizeof(io_uring_probe) + 256 * sizeof(io_uring_probe_op), 0);
+        io_uring_probe*   probe = reinterpret_cast<io_uring_probe*>(probeData.data());
+
+        if (syscall(__NR_io_uring_register, m_ringFd, IORING_REGISTER_PROBE, probe, 256) < 0)
+            return false;
+
+        for (int op : {IORING_OP_OPENAT, IORING_OP_READ, IORING_OP_CLOSE})
+        {
+            if (op > probe->last_op || (probe->ops[op].flags & IO_URING_OP_SUPPORTED) == 0)
+                return false;
+        }
+
+        m_queueDepth = params.sq_entries;
+        m_sqRingSize = params.sq_off.array + params.sq_entries * sizeof(unsigned int);
+        m_cqRingSize = params.cq_off.cqes + params.cq_entries * sizeof(io_uring_cqe);
+        m_sqesSize   = params.sq_entries * sizeof(io_uring_sqe);
+
+        const bool singleMap = (params.features & IORING_FEAT_SINGLE_MMAP) != 0;
+        if (singleMap)
+            m_sqRingSize = m_cqRingSize = std::max(m_sqRingSize, m_cqRingSize);
+
+        m_sqRing = mmap(nullptr, m_sqRingSize, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, m_ringFd, IORING_OFF_SQ_RING);
+        if (m_sqRing == MAP_FAILED)
+        {
+            m_sqRing = nullptr;
+            return false;
+        }
+
+        m_cqRing = singleMap ? m_sqRing : mmap(nullptr, m_cqRingSize, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, m_ringFd, IORING_OFF_CQ_RING);
+        if (m_cqRing == MAP_FAILED)
+        {
+            m_cqRing = nullptr;
+            return false;
+        }
+
+        m_sqes = mmap(nullptr, m_sqesSize, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, m_ringFd, IORING_OFF_SQES);
+        if (m_sqes == MAP_FAILED)
+        {
+            m_sqes = nullptr;
+            return false;
+        }
+
+        char* sq  = static_cast<char*>(m_sqRing);
+        char* cq  = static_cast<char*>(m_cqRing);
+        m_sqHead  = reinterpret_cast<unsigned int*>(sq + params.sq_off.head);
+        m_sqTail  = reinterpret_cast<unsigned int*>(sq + params.sq_off.tail);
+        m_sqMask  = reinterpret_cast<unsigned int*>(sq + params.sq_off.ring_mask);
+        m_sqArray = reinterpret_cast<unsigned int*>(sq + params.sq_off.array);
+        m_cqHead  = reinterpret_cast<unsigned int*>(cq + params.cq_off.head);
+        m_cqTail  = reinterpret_cast<unsigned int*>(cq + params.cq_off.tail);
+        m_cqMask  = reinterpret_cast<unsigned int*>(cq + params.cq_off.ring_mask);
+        m_cqes    = cq + params.cq_off.cqes;
+        return true;
+    }
+
+    void* UringFileReader::GetSubmissionEntry()
+    {
+        // Only this thread produces entries, the tail is published once the entry is filled by the caller's Submit.
+        const unsigned int tail  = *m_sqTail + m_toSubmit;
+        const unsigned int index = tail & *m_sqMask;
+        io_uring_sqe*      sqe   = static_cast<io_uring_sqe*>(m_sqes) + index;
+        std::memset(sqe, 0, sizeof(io_uring_sqe));
+        m_sqArray[index] = index;
+        m_toSubmit++;
+        return sqe;
+    }
+
+    void UringFileReader::Submit(unsigned int waitCount)
+    {
+        __atomic_store_n(m_sqTail, *m_sqTail + m_toSubmit, __ATOMIC_RELEASE);
+
+        const unsigned int flags = waitCount > 0 ? IORING_ENTER_GETEVENTS : 0;
+        while (syscall(__NR_io_uring_enter, m_ringFd, m_toSubmit, waitCount, flags, nullptr, 0) < 0 && errno == EINTR)
+            ;
+
+        m_toSubmit = 0;
+    }
+
+    void UringFileReader::QueueOpen(Request& request, const std::string& path, unsigned long long userData)
+    {
+        io_uring_sqe* sqe = static_cast<io_uring_sqe*>(GetSubmissionEntry());
+        sqe->opcode       = IORING_OP_OPENAT;
+        sqe->fd           = AT_FDCWD;
+        sqe->addr         = reinterpret_cast<unsigned long long>(path.c_str());
+        sqe->open_flags   = O_RDONLY | O_CLOEXEC;
+        sqe->user_data    = userData;
+        request.m_stage   = REQUEST_STAGE_OPEN;
+    }
+
+    void UringFileReader::QueueRead(Request& request, unsigned long long userData)
+    {
+        if (request.m_content.size() < request.m_offset + URING_READ_CHUNK)
+            request.m_content.resize(request.m_offset + URING_READ_CHUNK);
+
+        io_uring_sqe* sqe = static_cast<io_uring_sqe*>(GetSubmissionEntry());
+        sqe->opcode       = IORING_OP_READ;
+        sqe->fd           = request.m_fd;
+        sqe->addr         = reinterpret_cast<unsigned long long>(&request.m_content[request.m_offset]);
+        sqe->len          = static_cast<unsigned int>(request.m_content.size() - request.m_offset);
+        sqe->off          = request.m_offset;
+        sqe->user_data    = userData;
+        request.m_stage   = REQUEST_STAGE_READ;
+    }
+
+    void UringFileReader::QueueClose(Request& request, unsigned long long userData)
+    {
+        io_uring_sqe* sqe = static_cast<io_uring_sqe*>(GetSubmissionEntry());
+        sqe->opcode       = IORING_OP_CLOSE;
+        sqe->fd           = request.m_fd;
+        sqe->user_data    = userData;
+        request.m_stage   = REQUEST_STAGE_CLOSE;
+    }
+
+    void UringFileReader::ReadFiles(const std::vector<std::string>& paths, const ReadCallback& onRead)
+    {
+        // Every slot carries one file through open, read & close, one operation in flight at a time.
+        std::vector<Request> requests(std::min<size_t>(m_queueDepth, paths.size()));
+        size_t               nextPath = 0;
+        size_t               inFlight = 0;
+
+        auto startNext = [&](size_t slot) {
+            requests[slot]         = Request();
+            requests[slot].m_index = nextPath;
+            QueueOpen(requests[slot], paths[nextPath], slot);
+            nextPath++;
+            inFlight++;
+        };
+
+        for (size_t slot = 0; slot < requests.size(); slot++)
+            startNext(slot);
+
+        while (inFlight > 0)
+        {
+            Submit(1);
+
+            unsigned int       head = *m_cqHead;
+            const unsigned int tail = __atomic_load_n(m_cqTail, __ATOMIC_ACQUIRE);
+
+            for (; head != tail; head++)
+            {
+                const io_uring_cqe* cqe     = static_cast<const io_uring_cqe*>(m_cqes) + (head & *m_cqMask);
+                const size_t        slot    = static_cast<size_t>(cqe->user_data);
+                const int           res     = cqe->res;
+                Request&            request = requests[slot];
+                bool                done    = false;
+
+                if (request.m_stage == REQUEST_STAGE_OPEN)
+                {
+                    if (res >= 0)
+                    {
+                        request.m_fd = res;
+                        QueueRead(request, slot);
+                    }
+                    else
+                    {
+                        // Could be an unsupported opcode as well as a missing file, let the blocking path decide.
+                        std::string content;
+                        if (ReadWholeFile(paths[request.m_index], content))
+                            onRead(request.m_index, content);
+                        else
+                            ReportReadError(paths[request.m_index], std::strerror(-res));
+                        done = true;
+                    }
+                }
+                else if (request.m_stage == REQUEST_STAGE_READ)
+                {
+                    // Short reads are resubmitted for the remainder, only reading nothing is the end of the file.
+                    if (res > 0)
+                    {
+                        request.m_offset += res;
+                        QueueRead(request, slot);
+                    }
+                    else if (res == -EINTR || res == -EAGAIN)
+                        QueueRead(request, slot);
+                    else
+                    {
+                        if (res == 0)
+                        {
+                            request.m_content.resize(request.m_offset);
+                            onRead(request.m_index, request.m_content);
+                        }
+                        else
+                            ReportReadError(paths[request.m_index], std::strerror(-res));
+
+                        QueueClose(request, slot);
+                    }
+                }
+                else
+                    done = true;
+
+                if (done)
+                {
+                    inFlight--;
+                    if (nextPath < paths.size())
+                        startNext(slot);
+                }
+            }
+
+            __atomic_store_n(m_cqHead, head, __ATOMIC_RELEASE);
+        }
+    }
+#endif
+} // namespace Lina
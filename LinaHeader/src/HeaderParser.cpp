@@ -0,0 +1,311 @@
+/*
+This file is a part of: Lina Engine
+https://github.com/inanevin/LinaEngine
+
+Author: Inan Evin
+http://www.inanevin.com
+
+Copyright (c) [2018-2020] [Inan Evin]
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+#include "HeaderParser.hpp"
+#include "StringLiteral.hpp"
+#include <algorithm>
+#include <cctype>
+
+namespace Lina
+{
+
+#define LINA_CLASS_MACRO     "LINA_CLASS("
+#define LINA_COMPONENT_MACRO "LINA_COMPONENT("
+#define LINA_PROPERTY_MACRO  "LINA_PROPERTY("
+
+    void HeaderParser::Parse(const std::string& content, LinaHeaderData& data)
+    {
+        // Nothing carries over from the previously parsed header.
+        m_lastNamespace          = "";
+        nextLineIsComponent      = false;
+        nextLineIsClass          = false;
+        nextLineIsProperty       = false;
+        m_lastHeaderWasComponent = false;
+
+        size_t      lineStart = 0;
+        std::string line;
+
+        // Read the hpp line by line, find LINA_CLASS and LINA_PROPERTY macros.
+        while (lineStart <= content.size())
+        {
+            size_t lineEnd = content.find('\n', lineStart);
+            if (lineEnd == std::string::npos)
+                lineEnd = content.size();
+
+            line      = content.substr(lineStart, lineEnd - lineStart);
+            lineStart = lineEnd + 1;
+
+            if (!line.empty() && line.back() == '\r')
+                line.pop_back();
+
+            if (nextLineIsComponent)
+            {
+                std::string componentName = line.substr(0, line.find(":"));
+                const bool  isStruct      = line.find("struct") < line.find("class");
+                RemoveWordFromLine(componentName, "class");
+                RemoveWordFromLine(componentName, "struct");
+                RemoveWhitespaces(componentName);
+
+                nextLineIsComponent               = false;
+                LinaComponent linaComponent       = m_lastComponentData;
+                linaComponent.m_nameWithNamespace = m_lastNamespace + "::" + componentName;
+                linaComponent.m_name              = componentName;
+                linaComponent.m_isStruct          = isStruct;
+                linaComponent.m_bases             = ProcessBaseClause(line);
+                data.m_components.push_back(linaComponent);
+                m_lastHeaderWasComponent = true;
+            }
+            else if (nextLineIsClass)
+            {
+                std::string className = line.substr(0, line.find(":"));
+                RemoveWordFromLine(className, "class");
+                RemoveWordFromLine(className, "struct");
+                RemoveWhitespaces(className);
+
+                nextLineIsClass               = false;
+                LinaClass linaClass           = m_lastClassData;
+                linaClass.m_nameWithNamespace = m_lastNamespace + "::" + className;
+                linaClass.m_name              = className;
+                linaClass.m_bases             = ProcessBaseClause(line);
+                data.m_classes.push_back(linaClass);
+                m_lastHeaderWasComponent = false;
+            }
+            else if (nextLineIsProperty)
+            {
+                // We have read the property macro, now we will read the property name
+                auto equals = line.find("=") != std::string::npos;
+
+                // If has equals sign, remove everything after the sign including the sign.
+                // If not, just remove the ;
+                if (equals)
+                {
+                    auto equals = line.find("=");
+                    line        = line.substr(0, equals);
+                }
+                else
+                    line = line.substr(0, line.find(";"));
+
+                // Remove the last line until it's not a whitespace.
+                while (!line.empty() && std::isspace(line.back()))
+                    line = line.substr(0, line.length() - 1);
+
+                // Now the last character should be the last char of the variable's name
+                // Find the last whitespace, which should be the one right before the variable name
+                // and cut the string before that. Everything before it is the member's type.
+                const size_t nameStart  = line.find_last_of(' ');
+                std::string  memberType = nameStart == std::string::npos ? "" : line.substr(0, nameStart);
+                memberType.erase(0, memberType.find_first_not_of(" \t"));
+                memberType.erase(memberType.find_last_not_of(" \t") + 1);
+
+                line = line.substr(nameStart + 1);
+                RemoveWhitespaces(line);
+
+                m_lastProperty.m_propertyName = line;
+                m_lastProperty.m_memberType   = memberType;
+
+                if (m_lastHeaderWasComponent && !data.m_components.empty())
+                    data.m_components.back().m_properties.push_back(m_lastProperty);
+                else if (!m_lastHeaderWasComponent && !data.m_classes.empty())
+                    data.m_classes.back().m_properties.push_back(m_lastProperty);
+
+                nextLineIsProperty = false;
+            }
+            else
+            {
+                if (line.find(LINA_COMPONENT_MACRO) != std::string::npos)
+                {
+                    ProcessComponentMacro(line);
+                    nextLineIsComponent = true;
+                }
+                else if (line.find(LINA_PROPERTY_MACRO) != std::string::npos)
+                {
+                    ProcessPropertyMacro(line);
+                    nextLineIsProperty = true;
+                }
+                else if (line.find(LINA_CLASS_MACRO) != std::string::npos)
+                {
+                    ProcessClassMacro(line);
+                    nextLineIsClass = true;
+                }
+                else if (line.find("namespace") != std::string::npos)
+                {
+                    RemoveBrackets(line);
+                    RemoveString(line, "namespace");
+                    RemoveWhitespaces(line);
+
+                    if (line.find("Lina::") != std::string::npos)
+                        RemoveString(line, "Lina::");
+                    m_lastNamespace = line;
+                }
+            }
+        }
+    }
+
+    void HeaderParser::RemoveWordFromLine(std::string& line, const std::string& word)
+    {
+        auto n = line.find(word);
+        if (n != std::string::npos)
+        {
+            line.erase(n, word.length());
+        }
+    }
+
+    void HeaderParser::ProcessPropertyMacro(const std::string& line)
+    {
+        std::vector<std::string> items = ReadStringLiterals(line);
+        for (auto& item : items)
+            RemoveWhitespacesPreAndPost(item);
+
+        // The fifth item, "min, max, precision", is optional.
+        items.resize(std::max(items.size(), size_t(4)));
+        m_lastProperty.m_title     = items[0];
+        m_lastProperty.m_type      = items[1];
+        m_lastProperty.m_tooltip   = items[2];
+        m_lastProperty.m_dependsOn = items[3];
+        m_lastProperty.m_range     = items.size() > 4 ? items[4] : "";
+    }
+
+    std::vector<std::string> HeaderParser::ProcessBaseClause(const std::string& line)
+    {
+        // struct PointLightComponent : public LightComponent, private Foo<A, B> {
+        std::vector<std::string> bases;
+        const size_t             colon = line.find(":");
+
+        if (colon == std::string::npos)
+            return bases;
+
+        std::string clause = line.substr(colon + 1);
+        clause             = clause.substr(0, clause.find("{"));
+
+        std::string base  = "";
+        int         depth = 0;
+
+        for (size_t i = 0; i <= clause.size(); i++)
+        {
+            const char c = i < clause.size() ? clause[i] : ',';
+
+            if (c == ',' && depth == 0)
+            {
+                RemoveWordFromLine(base, "public");
+                RemoveWordFromLine(base, "protected");
+                RemoveWordFromLine(base, "private");
+                RemoveWordFromLine(base, "virtual");
+                RemoveWhitespaces(base);
+
+                if (base.find("::") == 0)
+                    base = base.substr(2);
+
+                if (base.find("Lina::") == 0)
+                    RemoveString(base, "Lina::");
+
+                if (!base.empty())
+                    bases.push_back(base);
+
+                base = "";
+                continue;
+            }
+
+            depth += c == '<' ? 1 : c == '>' ? -1 : 0;
+            base += c;
+        }
+
+        return bases;
+    }
+
+    void HeaderParser::ProcessComponentMacro(const std::string& line)
+    {
+        std::vector<std::string> items = ReadStringLiterals(line);
+        for (auto& item : items)
+            RemoveWhitespacesPreAndPost(item);
+
+        items.resize(std::max(items.size(), size_t(5)));
+        m_lastComponentData.m_title                = items[0];
+        m_lastComponentData.m_icon                 = items[1];
+        m_lastComponentData.m_category             = items[2];
+        m_lastComponentData.m_canAddComponent      = items[3].compare("true") == 0;
+        m_lastComponentData.m_listenToValueChanged = items[4].compare("true") == 0;
+    }
+
+    void HeaderParser::ProcessClassMacro(const std::string& line)
+    {
+        std::vector<std::string> items = ReadStringLiterals(line);
+
+        if (!items.empty())
+            RemoveWhitespacesPreAndPost(items[0]);
+
+        m_lastClassData.m_title = items.empty() ? "" : items[0];
+    }
+
+    void HeaderParser::RemoveWhitespaces(std::string& str)
+    {
+        std::string::iterator end_pos = std::remove(str.begin(), str.end(), ' ');
+        str.erase(end_pos, str.end());
+    }
+
+    void HeaderParser::RemoveWhitespacesPreAndPost(std::string& str)
+    {
+        const size_t firstChar = str.find_first_not_of(' ');
+        const size_t lastChar  = str.find_last_not_of(' ');
+
+        if (str.size() > lastChar)
+            str = str.substr(firstChar, lastChar - firstChar + 1);
+    }
+
+    void HeaderParser::RemoveComma(std::string& str)
+    {
+        std::string::iterator end_pos = std::remove(str.begin(), str.end(), ',');
+        str.erase(end_pos, str.end());
+    }
+
+    void HeaderParser::RemoveDoubleQuote(std::string& str)
+    {
+        std::string::iterator end_pos = std::remove(str.begin(), str.end(), '"');
+        str.erase(end_pos, str.end());
+    }
+
+    void HeaderParser::RemoveString(std::string& str, const std::string& toErase)
+    {
+        size_t pos = str.find(toErase);
+        str.erase(pos, toErase.length());
+    }
+
+    void HeaderParser::RemoveBrackets(std::string& str)
+    {
+        if (str.find("{") != std::string::npos)
+        {
+            std::string::iterator end_pos = std::remove(str.begin(), str.end(), '{');
+            str.erase(end_pos, str.end());
+        }
+
+        if (str.find("}") != std::string::npos)
+        {
+            std::string::iterator end_pos = std::remove(str.begin(), str.end(), '}');
+            str.erase(end_pos, str.end());
+        }
+    }
+} // namespace Lina
@@ -27,33 +27,43 @@ SOFTWARE.
 */
 
 #include "HeaderTool.hpp"
+#include "FileReader.hpp"
+#include "HeaderParser.hpp"
+#include "Quantization.hpp"
+#include "ReflectionDatabase.hpp"
+#include "StringLiteral.hpp"
+#include "StringPool.hpp"
+#include <algorithm>
+#include <cctype>
+#include <chrono>
+#include <cmath>
+#include <cstring>
 #include <fstream>
 #include <iostream>
+#include <map>
 #include <sstream>
 #include <stdio.h>
 #include <filesystem>
+#include <thread>
 
 #define ROOT_PATH         "../../"
 #define REGISTRY_CPP_PATH "../../LinaEngine/src/Core/ReflectionRegistry.cpp"
-
-int main(int argc, char** argv)
-{
-    Lina::HeaderTool tool;
-    tool.Run(ROOT_PATH);
-    tool.SerializeReadData();
-    return 0;
-}
+#define DATABASE_PATH     "../../LinaEngine/src/Core/reflection.linadb"
+#define COMPONENTS_PATH   "../../LinaEngine/src/Core/ReflectedComponents.hpp"
+#define IDS_PATH          "../../LinaEngine/src/Core/ReflectedComponents.ids"
 
 namespace Lina
 {
 
-#define LINA_CLASS_MACRO             "LINA_CLASS("
-#define LINA_COMPONENT_MACRO         "LINA_COMPONENT("
-#define LINA_PROPERTY_MACRO          "LINA_PROPERTY("
-#define REGISTER_FUNC_BGN_IDENTIFIER "//REGFUNC_BEGIN"
-#define REGISTER_FUNC_END_IDENTIFIER "//REGFUNC_END"
-#define INCLUDE_BGN_IDENTIFIER       "//INC_BEGIN"
-#define INCLUDE_END_IDENTIFIER       "//INC_END"
+#define REGISTER_FUNC_BGN_IDENTIFIER  "//REGFUNC_BEGIN"
+#define REGISTER_FUNC_END_IDENTIFIER  "//REGFUNC_END"
+#define INCLUDE_BGN_IDENTIFIER        "//INC_BEGIN"
+#define INCLUDE_END_IDENTIFIER        "//INC_END"
+#define REGISTER_TYPES_BGN_IDENTIFIER "//REGTYPES_BEGIN"
+#define REGISTER_TYPES_END_IDENTIFIER "//REGTYPES_END"
+#define EDITOR_PROPS_MACRO            "REF_EDITOR_PROPS"
+#define WRITE_BUFFER_SIZE             64 * 1024
+#define MAX_COMPONENT_ID              4095 // Bounds the dispatch table & component masks an .ids file can ask for.
 
     std::vector<std::string> excludePaths{
         ".vs",
@@ -71,409 +81,2092 @@ namespace Lina
     };
 
     HeaderTool::~HeaderTool()
+    {
+        Clear();
+    }
+
+    void HeaderTool::Clear()
     {
         for (auto& p : m_componentData)
             delete p.second;
+
+        for (auto& p : m_classData)
+            delete p.second;
+
+        m_componentData.clear();
+        m_classData.clear();
+        m_flatProperties.clear();
+        m_headerHashes.clear();
+        m_visitedHeaders.clear();
+        m_headerFiles.clear();
     }
 
-    void HeaderTool::Run(const std::string& path)
+    void HeaderTool::AddModule(const LinaModule& module)
     {
-        // Scan each folder & sub-folders and find all .hpp files.
-        for (const auto& entry : std::filesystem::directory_iterator(path))
+        LinaModule added = module;
+        for (auto& root : added.m_roots)
+            root = NormalizeRoot(root);
+
+        m_modules.push_back(added);
+    }
+
+    void HeaderTool::SetCache(const std::string& directory, uint64_t sizeMB)
+    {
+        m_cacheDirectory = directory;
+        m_cacheSizeMB    = sizeMB;
+        m_parseCache.Open(m_cacheDirectory, m_cacheSizeMB * 1024 * 1024);
+    }
+
+    void HeaderTool::SetJobs(unsigned int jobs)
+    {
+        m_jobs = jobs;
+    }
+
+    void HeaderTool::SetIOBackend(FileReaderBackend backend)
+    {
+        m_ioBackend = backend;
+    }
+
+    bool HeaderTool::ReadCommandLine(int argc, char** argv)
+    {
+        // Arguments are --key value pairs, the keys are the same as in a config file.
+        for (int i = 1; i < argc; i++)
         {
-            if (entry.path().has_extension())
-            {
-                const std::string fullName  = entry.path().filename().string();
-                const std::string extension = fullName.substr(fullName.find(".") + 1);
+            const std::string arg = argv[i];
 
-                // Skip the property declaration file.
-                if (fullName.find("CommonReflection") == std::string::npos && extension.compare("hpp") == 0 || extension.compare("h") == 0)
-                {
-                    std::string replacedPath = entry.path().string();
-                    std::replace(replacedPath.begin(), replacedPath.end(), '\\', '/');
-                    std::string include = replacedPath.substr(replacedPath.find("include"));
-                    m_lastHPPInclude    = include.substr(include.find_first_of("/") + 1);
-                    ReadHPP(entry.path().string());
-                }
+            if (arg.rfind("--", 0) != 0 || i + 1 >= argc)
+            {
+                std::cerr << "Lina Header Tool: invalid argument " << arg << std::endl;
+                return false;
             }
-            else
+
+            const std::string key   = arg.substr(2);
+            const std::string value = argv[++i];
+
+            if (key.compare("config") == 0)
             {
+                if (!ReadConfig(value))
+                    return false;
+            }
+            else if (!AddOption(key, value, ""))
+                return false;
+        }
 
-                std::string replacedPath = entry.path().string();
+        if (!m_cacheDirectory.empty())
+            SetCache(m_cacheDirectory, m_cacheSizeMB);
 
-                bool shouldExclude = false;
-                for (auto& excludeStr : excludePaths)
-                {
-                    if (replacedPath.find(excludeStr) != std::string::npos)
-                    {
-                        shouldExclude = true;
-                        break;
-                    }
-                }
+        // No modules given, default to the engine registry.
+        if (m_modules.empty())
+        {
+            LinaModule module;
+            module.m_name         = "LinaEngine";
+            module.m_roots        = {NormalizeRoot(ROOT_PATH)};
+            module.m_registryPath = REGISTRY_CPP_PATH;
+            module.m_databasePath = DATABASE_PATH;
+            module.m_headerPath   = COMPONENTS_PATH;
+            module.m_idsPath      = IDS_PATH;
+            m_modules.push_back(module);
+        }
 
-                if (!shouldExclude)
-                {
-                    std::replace(replacedPath.begin(), replacedPath.end(), '\\', '/');
-                    Run(replacedPath);
-                }
+        for (auto& module : m_modules)
+        {
+            if (module.m_roots.empty() || module.m_registryPath.empty())
+            {
+                std::cerr << "Lina Header Tool: module " << module.m_name << " needs at least one root and an output." << std::endl;
+                return false;
             }
         }
+
+        return true;
     }
 
-    void HeaderTool::ReadHPP(const std::string& hpp)
+    bool HeaderTool::ReadConfig(const std::string& path)
     {
         std::ifstream file;
-        file.open(hpp);
-        std::string line;
+        file.open(path);
+
+        if (!file.is_open())
+        {
+            std::cerr << "Lina Header Tool: could not open config " << path << std::endl;
+            return false;
+        }
+
+        // Relative paths inside a config file are relative to the file itself.
+        const std::string baseDir = std::filesystem::path(path).parent_path().string();
+        std::string       line;
+
+        while (getline(file, line))
+        {
+            HeaderParser::RemoveWhitespacesPreAndPost(line);
+
+            if (line.empty() || line[0] == '#')
+                continue;
+
+            const size_t separator = line.find_first_of(" \t");
+            std::string  key       = line.substr(0, separator);
+            std::string  value     = separator == std::string::npos ? "" : line.substr(separator + 1);
+            HeaderParser::RemoveWhitespacesPreAndPost(value);
+
+            if (!AddOption(key, value, baseDir))
+                return false;
+        }
 
-        // Read the hpp line by line, find LINA_CLASS and LINA_PROPERTY macros.
-        if (file.is_open())
+        return true;
+    }
+
+    bool HeaderTool::AddOption(const std::string& key, const std::string& value, const std::string& baseDir)
+    {
+        if (key.compare("cache") == 0)
         {
-            while (file.good())
+            // "default" picks the per-user cache folder, e.g. $XDG_CACHE_HOME/lina-header.
+            std::string directory = value.compare("default") == 0 ? ParseCache::GetDefaultDirectory() : value;
+
+            if (!baseDir.empty() && value.compare("default") != 0)
+                directory = (std::filesystem::path(baseDir) / value).string();
+
+            if (directory.empty())
             {
-                getline(file, line);
-                if (nextLineIsComponent)
-                {
-                    std::string componentName = line.substr(0, line.find(":"));
-                    RemoveWordFromLine(componentName, "class");
-                    RemoveWordFromLine(componentName, "struct");
-                    RemoveWhitespaces(componentName);
-
-                    nextLineIsComponent                = false;
-                    LinaComponent* linaComponent       = new LinaComponent();
-                    *linaComponent                     = m_lastComponentData;
-                    linaComponent->m_hppInclude        = m_lastHPPInclude;
-                    linaComponent->m_nameWithNamespace = m_lastNamespace + "::" + componentName;
-                    linaComponent->m_name              = componentName;
-                    m_componentData[componentName]     = linaComponent;
-                    m_namespaceComponentMap[m_lastNamespace].push_back(linaComponent);
-                    m_lastClass              = componentName;
-                    m_lastHeaderWasComponent = true;
-                }
-                else if (nextLineIsClass)
-                {
-                    std::string className = line.substr(0, line.find(":"));
-                    RemoveWordFromLine(className, "class");
-                    RemoveWordFromLine(className, "struct");
-                    RemoveWhitespaces(className);
-
-                    nextLineIsClass                = false;
-                    LinaClass* linaClass           = new LinaClass();
-                    *linaClass                     = m_lastClassData;
-                    linaClass->m_hppInclude        = m_lastHPPInclude;
-                    linaClass->m_nameWithNamespace = m_lastNamespace + "::" + className;
-                    linaClass->m_name              = className;
-                    m_classData[className]         = linaClass;
-                    m_namespaceClassMap[m_lastNamespace].push_back(linaClass);
-                    m_lastClass              = className;
-                    m_lastHeaderWasComponent = false;
-                }
-                else if (nextLineIsProperty)
-                {
-                    // We have read the property macro, now we will read the property name
-                    auto equals = line.find("=") != std::string::npos;
+                std::cerr << "Lina Header Tool: could not determine a cache folder." << std::endl;
+                return false;
+            }
 
-                    // If has equals sign, remove everything after the sign including the sign.
-                    // If not, just remove the ;
-                    if (equals)
-                    {
-                        auto equals = line.find("=");
-                        line        = line.substr(0, equals);
-                    }
-                    else
-                        line = line.substr(0, line.find(";"));
+            m_cacheDirectory = directory;
+            return true;
+        }
+        else if (key.compare("cache-size") == 0)
+        {
+            m_cacheSizeMB = std::strtoull(value.c_str(), nullptr, 10);
+            return true;
+        }
+        else if (key.compare("io") == 0)
+        {
+            if (value.compare("blocking") == 0)
+                m_ioBackend = FileReaderBackend::Blocking;
+            else if (value.compare("uring") == 0)
+                m_ioBackend = FileReaderBackend::Uring;
+            else
+            {
+                std::cerr << "Lina Header Tool: unknown io backend " << value << ", expected blocking or uring." << std::endl;
+                return false;
+            }
+            return true;
+        }
+        else if (key.compare("jobs") == 0)
+        {
+            // 0 uses every core, a jobserver in MAKEFLAGS lowers it further.
+            m_jobs = static_cast<unsigned int>(std::max(0, std::atoi(value.c_str())));
+            return true;
+        }
+        else if (key.compare("benchmark-io") == 0)
+        {
+            m_ioBenchmarkRuns = std::max(1, std::atoi(value.c_str()));
+            return true;
+        }
+        else if (key.compare("module") == 0)
+        {
+            LinaModule module;
+            module.m_name = value;
+            m_modules.push_back(module);
+            return true;
+        }
+        else if (key.compare("layout-budget") == 0)
+        {
+            // ECS::LightComponent=64
+            const size_t separator = value.find('=');
+            if (separator == std::string::npos)
+            {
+                std::cerr << "Lina Header Tool: expected <type>=<bytes> for layout-budget, got " << value << std::endl;
+                return false;
+            }
 
-                    // Remove the last line until it's not a whitespace.
-                    while (std::isspace(line.back()))
-                        line = line.substr(0, line.length() - 1);
+            if (m_modules.empty())
+                m_modules.push_back(LinaModule());
 
-                    // Now the last character should be the last char of the variable's name
-                    // Find the last whitespace, which should be the one right before the variable name
-                    // and cut the string before that.
-                    line = line.substr(line.find_last_of(' '));
-                    RemoveWhitespaces(line);
+            m_modules.back().m_layoutBudgets[value.substr(0, separator)] = std::strtoull(value.c_str() + separator + 1, nullptr, 10);
+            return true;
+        }
 
-                    m_lastProperty.m_propertyName = line;
+        const std::string path = baseDir.empty() ? value : (std::filesystem::path(baseDir) / value).string();
 
-                    if (m_lastHeaderWasComponent)
-                        m_componentData[m_lastClass]->m_properties.push_back(m_lastProperty);
-                    else
-                        m_classData[m_lastClass]->m_properties.push_back(m_lastProperty);
+        if (key.compare("root") != 0 && key.compare("output") != 0 && key.compare("database") != 0 && key.compare("pch") != 0 && key.compare("header") != 0 && key.compare("ids") != 0 &&
+            key.compare("layout-report") != 0)
+        {
+            std::cerr << "Lina Header Tool: unknown option " << key << std::endl;
+            return false;
+        }
 
-                    nextLineIsProperty = false;
-                }
-                else
-                {
-                    if (line.find(LINA_COMPONENT_MACRO) != std::string::npos)
-                    {
-                        ProcessComponentMacro(line);
-                        nextLineIsComponent = true;
-                    }
-                    else if (line.find(LINA_PROPERTY_MACRO) != std::string::npos)
-                    {
-                        ProcessPropertyMacro(line);
-                        nextLineIsProperty = true;
-                    }
-                    else if (line.find(LINA_CLASS_MACRO) != std::string::npos)
-                    {
-                        ProcessClassMacro(line);
-                        nextLineIsClass = true;
-                    }
-                    else if (line.find("namespace") != std::string::npos)
-                    {
-                        RemoveBrackets(line);
-                        RemoveString(line, "namespace");
-                        RemoveWhitespaces(line);
+        // Options given before any module apply to an unnamed one.
+        if (m_modules.empty())
+            m_modules.push_back(LinaModule());
 
-                        if (line.find("Lina::") != std::string::npos)
-                            RemoveString(line, "Lina::");
-                        m_lastNamespace = line;
-                    }
+        LinaModule& module = m_modules.back();
+
+        if (key.compare("root") == 0)
+            module.m_roots.push_back(NormalizeRoot(path));
+        else if (key.compare("output") == 0)
+            module.m_registryPath = path;
+        else if (key.compare("database") == 0)
+            module.m_databasePath = path;
+        else if (key.compare("header") == 0)
+            module.m_headerPath = path;
+        else if (key.compare("ids") == 0)
+            module.m_idsPath = path;
+        else if (key.compare("layout-report") == 0)
+            module.m_layoutPath = path;
+        else
+            module.m_pchPath = path;
+
+        return true;
+    }
+
+    std::string HeaderTool::NormalizeRoot(const std::string& path)
+    {
+        std::string root = std::filesystem::weakly_canonical(path).generic_string();
+        if (root.empty() || root.back() != '/')
+            root += "/";
+        return root;
+    }
+
+    std::set<std::string> HeaderTool::GetModuleIncludes(const LinaModule& module)
+    {
+        // Several types usually share a header, each one is included once.
+        std::set<std::string> includes;
+
+        for (auto& [actualName, compData] : m_componentData)
+        {
+            if (IsInModule(compData->m_hppPath, module))
+                includes.insert(compData->m_hppInclude);
+        }
+
+        for (auto& [actualName, classData] : m_classData)
+        {
+            if (IsInModule(classData->m_hppPath, module))
+                includes.insert(classData->m_hppInclude);
+        }
+
+        return includes;
+    }
+
+    bool HeaderTool::IsInModule(const std::string& hppPath, const LinaModule& module)
+    {
+        for (auto& root : module.m_roots)
+        {
+            if (hppPath.compare(0, root.length(), root) == 0)
+                return true;
+        }
+
+        return false;
+    }
+
+    void HeaderTool::ScanRoots()
+    {
+        std::vector<std::string> roots;
+        for (auto& module : m_modules)
+            roots.insert(roots.end(), module.m_roots.begin(), module.m_roots.end());
+
+        // Sorted, a parent root comes before the roots nested inside it, which are then already covered.
+        std::sort(roots.begin(), roots.end());
+        roots.erase(std::unique(roots.begin(), roots.end()), roots.end());
+
+        std::vector<std::string> scanRoots;
+        for (auto& root : roots)
+        {
+            bool nested = false;
+            for (auto& scanRoot : scanRoots)
+            {
+                if (root.compare(0, scanRoot.length(), scanRoot) == 0)
+                {
+                    nested = true;
+                    break;
                 }
             }
+
+            if (!nested)
+            {
+                scanRoots.push_back(root);
+                ScanDirectory(root);
+            }
         }
     }
 
-    void HeaderTool::RemoveWordFromLine(std::string& line, const std::string& word)
+    void HeaderTool::Run()
+    {
+        // A resident instance may run several times, each run starts from scratch.
+        Clear();
+        ScanRoots();
+        ReadHeaderFiles(m_headerFiles);
+        ResolveInheritance();
+
+        if (m_parseCache.IsEnabled())
+            m_parseCache.Trim();
+    }
+
+    bool HeaderTool::UpdateFiles(const std::vector<std::string>& paths)
     {
-        auto n = line.find(word);
-        if (n != std::string::npos)
+        std::vector<LinaHeaderFile> headerFiles;
+        bool                        changed = false;
+
+        for (auto& path : paths)
         {
-            line.erase(n, word.length());
+            const std::string hppPath = std::filesystem::weakly_canonical(path).generic_string();
+
+            if (!std::filesystem::is_regular_file(hppPath))
+            {
+                // Deleted or renamed away.
+                changed |= RemoveHeaderData(hppPath);
+                m_headerHashes.erase(hppPath);
+
+                if (m_visitedHeaders.erase(hppPath) != 0)
+                    m_headerFiles.erase(std::remove_if(m_headerFiles.begin(), m_headerFiles.end(), [&](const LinaHeaderFile& file) { return file.m_path == hppPath; }), m_headerFiles.end());
+
+                continue;
+            }
+
+            if (!IsReflectedHeader(hppPath))
+                continue;
+
+            const LinaHeaderFile headerFile = CreateHeaderFile(hppPath);
+
+            if (m_visitedHeaders.insert(hppPath).second)
+                m_headerFiles.push_back(headerFile);
+
+            headerFiles.push_back(headerFile);
         }
+
+        changed |= ReadHeaderFiles(headerFiles);
+        ResolveInheritance();
+        return changed;
     }
 
-    void HeaderTool::ProcessPropertyMacro(const std::string& line)
+    bool HeaderTool::ReadHeaderFiles(const std::vector<LinaHeaderFile>& headerFiles)
     {
-        std::string trimmed           = line.substr(line.find("(") + 1);
-        std::string insideParanthesis = trimmed.substr(0, trimmed.find(")"));
+        std::vector<std::string> paths;
+        for (auto& headerFile : headerFiles)
+            paths.push_back(headerFile.m_path);
+
+        // Headers are parsed on the workers as their reads complete, while the remaining reads are still in flight.
+        std::vector<std::string>    contents(headerFiles.size());
+        std::vector<LinaHeaderData> results(headerFiles.size());
+        std::vector<char>           parsed(headerFiles.size(), 0);
+        bool                        changed = false;
+
+        // Only the implicit token is left with an unusable jobserver, fall back for this read & keep the configured --jobs.
+        // The jobserver reports the fallback when it first fails to connect.
+        const unsigned int workerLimit = m_jobServer.Connect() == JobServerState::Unusable ? 1 : GetWorkerLimit();
 
-        const int itemCount = 4;
-        for (int i = 0; i < itemCount; i++)
         {
-            const size_t                               firstQuote = insideParanthesis.find("\"");
-            const size_t                                secondQuote = insideParanthesis.find("\"", firstQuote+1);
-            std::string property = insideParanthesis.substr(firstQuote + 1, secondQuote - 1 - firstQuote);
-            RemoveWhitespacesPreAndPost(property);
-            insideParanthesis = insideParanthesis.substr(secondQuote + 1);
+            const unsigned int workerCount = static_cast<unsigned int>(std::min<size_t>(workerLimit, std::max<size_t>(headerFiles.size(), 1)));
+
+            WorkerPool workers(m_jobServer, workerCount, [&](size_t index) {
+                LoadHPP(contents[index], results[index]);
+                std::string().swap(contents[index]);
+            });
+
+            std::unique_ptr<FileReader> reader = FileReader::Create(m_ioBackend);
+            reader->ReadFiles(paths, [&](size_t index, std::string& content) {
+                if (!IsHeaderChanged(headerFiles[index], content))
+                    return;
+
+                contents[index] = std::move(content);
+                parsed[index]   = 1;
+                changed         = true;
+                workers.Push(index);
+            });
+
+            workers.Finish();
+        }
 
-            if (i == 0)
-                m_lastProperty.m_title = property;
-            else if (i == 1)
-                m_lastProperty.m_type = property;
-            else if (i == 2)
-                m_lastProperty.m_tooltip = property;
-            else if (i == 3)
-                m_lastProperty.m_dependsOn = property;
+        // Added in the order of the headers, so the outcome does not depend on which worker finished first.
+        for (size_t i = 0; i < headerFiles.size(); i++)
+        {
+            if (parsed[i])
+                AddHeaderData(headerFiles[i], results[i]);
         }
+
+        return changed;
     }
 
-    void HeaderTool::ProcessComponentMacro(const std::string& line)
+    unsigned int HeaderTool::GetWorkerLimit() const
     {
-        std::string trimmed           = line.substr(line.find("(") + 1);
-        std::string insideParanthesis = trimmed.substr(0, trimmed.find(")"));
+        if (m_jobs != 0)
+            return m_jobs;
+
+        return std::max(1u, std::thread::hardware_concurrency());
+    }
 
-        const int itemCount = 5;
-        for (int i = 0; i < itemCount; i++)
+    void HeaderTool::Serialize()
+    {
+        for (auto& module : m_modules)
         {
-            const size_t firstQuote  = insideParanthesis.find("\"");
-            const size_t secondQuote = insideParanthesis.find("\"", firstQuote + 1);
-            std::string  property    = insideParanthesis.substr(firstQuote + 1, secondQuote - 1 - firstQuote);
-            RemoveWhitespacesPreAndPost(property);
-            insideParanthesis = insideParanthesis.substr(secondQuote + 1);
+            AssignComponentIDs(module);
+            SerializeReadData(module);
+
+            if (!module.m_headerPath.empty())
+                SerializeComponentHeader(module);
+
+            if (!module.m_databasePath.empty())
+                SerializeDatabase(module);
 
-            if (i == 0)
-                m_lastComponentData.m_title = property;
-            else if (i == 1)
-                m_lastComponentData.m_icon = property;
-            else if (i == 2)
-                m_lastComponentData.m_category = property;
-            else if (i == 3)
-                m_lastComponentData.m_canAddComponent = property.compare("true") == 0 ? true : false;
-            else if (i == 4)
-                m_lastComponentData.m_listenToValueChanged = property.compare("true") == 0 ? true : false;
+            if (!module.m_pchPath.empty())
+                SerializePCH(module);
+
+            if (!module.m_layoutPath.empty())
+                SerializeLayoutReport(module);
         }
     }
 
-    void HeaderTool::ProcessClassMacro(const std::string& line)
+    void HeaderTool::ScanDirectory(const std::string& path)
     {
-        std::string trimmed           = line.substr(line.find("(") + 1);
-        std::string insideParanthesis = trimmed.substr(0, trimmed.find(")"));
-
-        const int itemCount = 1;
-        for (int i = 0; i < itemCount; i++)
+        // Scan each folder & sub-folders and find all .hpp files.
+        for (const auto& entry : std::filesystem::directory_iterator(path))
         {
-            const size_t firstQuote  = insideParanthesis.find("\"");
-            const size_t secondQuote = insideParanthesis.find("\"", firstQuote + 1);
-            std::string  property    = insideParanthesis.substr(firstQuote + 1, secondQuote - 1 - firstQuote);
-            RemoveWhitespacesPreAndPost(property);
-            insideParanthesis = insideParanthesis.substr(secondQuote + 1);
+            const std::string fullName = entry.path().filename().string();
 
-            if (i == 0)
-                m_lastClassData.m_title = property;
+            if (entry.is_directory())
+            {
+                if (!IsExcludedDirectory(fullName))
+                    ScanDirectory(entry.path().generic_string());
+            }
+            else
+            {
+                // Roots may overlap between modules, each header is parsed only once.
+                const std::string hppPath = entry.path().generic_string();
+                if (IsReflectedHeader(hppPath) && m_visitedHeaders.insert(hppPath).second)
+                    m_headerFiles.push_back(CreateHeaderFile(hppPath));
+            }
         }
     }
 
-    void HeaderTool::RemoveWhitespaces(std::string& str)
+    bool HeaderTool::IsExcludedDirectory(const std::string& name)
     {
-        std::string::iterator end_pos = std::remove(str.begin(), str.end(), ' ');
-        str.erase(end_pos, str.end());
+        for (auto& excludeStr : excludePaths)
+        {
+            if (name.find(excludeStr) != std::string::npos)
+                return true;
+        }
+
+        return false;
     }
 
-    void HeaderTool::RemoveWhitespacesPreAndPost(std::string& str)
+    bool HeaderTool::IsReflectedHeader(const std::string& hppPath)
     {
-        const size_t firstChar = str.find_first_not_of(' ');
-        const size_t lastChar  = str.find_last_not_of(' ');
+        const std::filesystem::path path      = hppPath;
+        const std::string           extension = path.extension().string();
+
+        // Skip the property declaration file.
+        if ((extension.compare(".hpp") != 0 && extension.compare(".h") != 0) || path.filename().string().find("CommonReflection") != std::string::npos)
+            return false;
+
+        // Headers handed in by UpdateFiles must lie under a module root, outside of excluded folders, same as a scan would find them.
+        for (auto& module : m_modules)
+        {
+            for (auto& root : module.m_roots)
+            {
+                if (hppPath.compare(0, root.length(), root) != 0)
+                    continue;
 
-        if (str.size() > lastChar)
-            str = str.substr(firstChar, lastChar + 1);
+                bool              excluded  = false;
+                const std::string relative  = hppPath.substr(root.length());
+                size_t            dirStart  = 0;
+                size_t            separator = relative.find('/');
+
+                while (separator != std::string::npos && !excluded)
+                {
+                    excluded  = IsExcludedDirectory(relative.substr(dirStart, separator - dirStart));
+                    dirStart  = separator + 1;
+                    separator = relative.find('/', dirStart);
+                }
+
+                if (!excluded)
+                    return true;
+            }
+        }
+
+        return false;
+    }
+
+    LinaHeaderFile HeaderTool::CreateHeaderFile(const std::string& hppPath)
+    {
+        const size_t   includePos = hppPath.rfind("/include/");
+        LinaHeaderFile headerFile;
+        headerFile.m_path    = hppPath;
+        headerFile.m_include = includePos == std::string::npos ? hppPath.substr(hppPath.rfind('/') + 1) : hppPath.substr(includePos + 9);
+        return headerFile;
     }
 
-    void HeaderTool::RemoveComma(std::string& str)
+    bool HeaderTool::IsHeaderChanged(const LinaHeaderFile& headerFile, const std::string& content)
     {
-        std::string::iterator end_pos = std::remove(str.begin(), str.end(), ',');
-        str.erase(end_pos, str.end());
+        // Saving a header without changing it leaves the parsed data as it is.
+        const uint64_t key = ParseCache::GetKey(content);
+        auto           it  = m_headerHashes.find(headerFile.m_path);
+
+        if (it != m_headerHashes.end())
+        {
+            if (it->second == key)
+                return false;
+
+            RemoveHeaderData(headerFile.m_path);
+        }
+
+        m_headerHashes[headerFile.m_path] = key;
+        return true;
     }
 
-    void HeaderTool::RemoveDoubleQuote(std::string& str)
+    void HeaderTool::LoadHPP(const std::string& content, LinaHeaderData& data)
     {
-        std::string::iterator end_pos = std::remove(str.begin(), str.end(), '"');
-        str.erase(end_pos, str.end());
+        // Runs on the parse workers, the parse cache is the only shared state it touches.
+        // Parse results only depend on the content, so identical headers are shared across build folders & branches.
+        const uint64_t key = ParseCache::GetKey(content);
+
+        if (m_parseCache.IsEnabled() && m_parseCache.Load(key, content, data))
+            return;
+
+        ParseHPP(content, data);
+
+        if (m_parseCache.IsEnabled())
+            m_parseCache.Store(key, content, data);
     }
 
-    void HeaderTool::RemoveString(std::string& str, const std::string& toErase)
+    void HeaderTool::ParseHPP(const std::string& content, LinaHeaderData& data) const
     {
-        size_t pos = str.find(toErase);
-        str.erase(pos, toErase.length());
+        // A parser per header, so that workers never share parse state.
+        HeaderParser parser;
+        parser.Parse(content, data);
     }
 
-    void HeaderTool::RemoveBrackets(std::string& str)
+    void HeaderTool::AddHeaderData(const LinaHeaderFile& headerFile, const LinaHeaderData& data)
     {
-        if (str.find("{") != std::string::npos)
+        for (auto& component : data.m_components)
         {
-            std::string::iterator end_pos = std::remove(str.begin(), str.end(), '{');
-            str.erase(end_pos, str.end());
+            LinaComponent* linaComponent = new LinaComponent(component);
+            linaComponent->m_hppPath     = headerFile.m_path;
+            linaComponent->m_hppInclude  = headerFile.m_include;
+
+            LinaComponent*& slot = m_componentData[linaComponent->m_nameWithNamespace];
+            delete slot;
+            slot = linaComponent;
         }
 
-        if (str.find("}") != std::string::npos)
+        for (auto& linaClassData : data.m_classes)
         {
-            std::string::iterator end_pos = std::remove(str.begin(), str.end(), '}');
-            str.erase(end_pos, str.end());
+            LinaClass* linaClass    = new LinaClass(linaClassData);
+            linaClass->m_hppPath    = headerFile.m_path;
+            linaClass->m_hppInclude = headerFile.m_include;
+
+            LinaClass*& slot = m_classData[linaClass->m_nameWithNamespace];
+            delete slot;
+            slot = linaClass;
         }
     }
-    void HeaderTool::SerializeReadData()
+
+    bool HeaderTool::RemoveHeaderData(const std::string& hppPath)
     {
+        bool removed = false;
 
-        std::ifstream file;
-        std::string   line;
-        file.open(REGISTRY_CPP_PATH);
-        bool                     registerFunctionFound = false;
-        bool                     includeFound          = false;
-        std::vector<std::string> fileContents;
+        for (auto it = m_componentData.begin(); it != m_componentData.end();)
+        {
+            if (it->second->m_hppPath != hppPath)
+            {
+                ++it;
+                continue;
+            }
+
+            delete it->second;
+            it      = m_componentData.erase(it);
+            removed = true;
+        }
 
-        if (file.is_open())
+        for (auto it = m_classData.begin(); it != m_classData.end();)
         {
-            while (file.good())
+            if (it->second->m_hppPath != hppPath)
             {
-                getline(file, line);
+                ++it;
+                continue;
+            }
 
-                if (registerFunctionFound)
-                {
-                    if (line.find(REGISTER_FUNC_END_IDENTIFIER) == std::string::npos)
-                        continue;
-                    else
-                    {
-                        registerFunctionFound = false;
-                        fileContents.push_back(line);
-                    }
-                }
-                else if (includeFound)
-                {
-                    if (line.find(INCLUDE_END_IDENTIFIER) == std::string::npos)
-                        continue;
-                    else
-                    {
-                        includeFound = false;
-                        fileContents.push_back(line);
-                    }
-                }
-                else
-                    fileContents.push_back(line);
+            delete it->second;
+            it      = m_classData.erase(it);
+            removed = true;
+        }
 
-                if (line.find(INCLUDE_BGN_IDENTIFIER) != std::string::npos)
-                {
-                    includeFound = true;
+        return removed;
+    }
 
-                    for (auto& [actualName, compData] : m_componentData)
-                        fileContents.push_back("#include \"" + compData->m_hppInclude + "\"");
+    void HeaderTool::ResolveInheritance()
+    {
+        m_flatProperties.clear();
+        std::unordered_set<std::string> visiting;
 
-                    for (auto& [actualName, classData] : m_classData)
-                        fileContents.push_back("#include \"" + classData->m_hppInclude + "\"");
-                }
-                else if (line.find(REGISTER_FUNC_BGN_IDENTIFIER) != std::string::npos)
-                {
-                    registerFunctionFound = true;
-                    for (auto& [actualName, componentData] : m_componentData)
-                    {
-                        const std::string        className = componentData->m_nameWithNamespace;
-                        std::vector<std::string> functionCommands;
-                        functionCommands.push_back("entt::meta<" + className + ">().func<&REF_CloneComponent<" + className + ">, entt::as_void_t>(\"clone\"_hs);");
-                        functionCommands.push_back("entt::meta<" + className + ">().func<&REF_SerializeComponent<" + className + ">, entt::as_void_t>(\"serialize\"_hs);");
-                        functionCommands.push_back("entt::meta<" + className + ">().func<&REF_DeserializeComponent<" + className + ">, entt::as_void_t>(\"deserialize\"_hs);");
-                        functionCommands.push_back("entt::meta<" + className + ">().func<&REF_SetEnabled<" + className + ">, entt::as_void_t>(\"setEnabled\"_hs);");
-                        functionCommands.push_back("entt::meta<" + className + ">().func<&REF_Get<" + className + ">, entt::as_ref_t>(\"get\"_hs);");
-                        functionCommands.push_back("entt::meta<" + className + ">().func<&REF_Reset<" + className + ">, entt::as_void_t>(\"reset\"_hs);");
-                        functionCommands.push_back("entt::meta<" + className + ">().func<&REF_Has<" + className + ">, entt::as_void_t>(\"has\"_hs);");
-                        functionCommands.push_back("entt::meta<" + className + ">().func<&REF_Remove<" + className + ">, entt::as_void_t>(\"remove\"_hs);");
-                        functionCommands.push_back("entt::meta<" + className + ">().func<&REF_Copy<" + className + ">, entt::as_void_t>(\"copy\"_hs);");
-                        functionCommands.push_back("entt::meta<" + className + ">().func<&REF_Paste<" + className + ">, entt::as_void_t>(\"paste\"_hs);");
-
-                        if (componentData->m_canAddComponent)
-                            functionCommands.push_back("entt::meta<" + className + ">().func<&REF_Add<" + className + ">, entt::as_void_t>(\"add\"_hs);");
-
-                        if (componentData->m_listenToValueChanged)
-                            functionCommands.push_back("entt::meta<" + className + ">().func<&REF_ValueChanged<" + className + ">, entt::as_void_t>(\"add\"_hs);");
-
-                        // Class meta.
-                        fileContents.push_back("entt::meta<" + className + ">().type().props(std::make_pair(\"Title\"_hs, \"" + componentData->m_title + "\"), std::make_pair(\"Icon\"_hs," + componentData->m_icon + "), std::make_pair(\"Category\"_hs,\"" + componentData->m_category + "\"));");
-
-                        // inherited m_isEnabled
-                        fileContents.push_back("entt::meta<" + className + ">().data<&" + className + "::" + "m_isEnabled" + ">(\"m_isEnabled\"_hs);");
-
-                        for (auto& property : componentData->m_properties)
-                        {
-                            const std::string propRegister = "entt::meta<" + className + ">().data<&" + className + "::" + property.m_propertyName + ">(\"" + property.m_propertyName + "\"_hs)";
-                            const std::string dataRegister = ".props(std::make_pair(\"Title\"_hs,\"" + property.m_title + "\")," + "std::make_pair(\"Type\"_hs,\"" + property.m_type + "\")," + "std::make_pair(\"Tooltip\"_hs,\"" + property.m_tooltip + "\")," + "std::make_pair(\"Depends\"_hs,\"" + property.m_dependsOn + "\"_hs));";
-                            fileContents.push_back(propRegister + dataRegister);
-                        }
-
-                        for (auto& fc : functionCommands)
-                            fileContents.push_back(fc);
-                    }
+        for (auto& [name, componentData] : m_componentData)
+            FlattenProperties(name, visiting);
 
-                    for (auto& [actualName, classData] : m_classData)
-                    {
-                        const std::string className = classData->m_nameWithNamespace;
-                        fileContents.push_back("entt::meta<" + className + ">().type().props(\"Title\"_hs, \"" + classData->m_title + "\");");
-                        for (auto& property : classData->m_properties)
-                        {
-                            const std::string propRegister = "entt::meta<" + className + ">().data<&" + className + "::" + property.m_propertyName + ">(\"" + property.m_propertyName + "\"_hs)";
-                            const std::string dataRegister = ".props(std::make_pair(\"Title\"_hs,\"" + property.m_title + "\")," + "std::make_pair(\"Type\"_hs,\"" + property.m_type + "\")," + "std::make_pair(\"Tooltip\"_hs,\"" + property.m_tooltip + "\")," + "std::make_pair(\"Depends\"_hs,\"" + property.m_dependsOn + "\"_hs));";
-                            fileContents.push_back(propRegister + dataRegister);
-                        }
-                    }
-                }
-            }
+        for (auto& [name, classData] : m_classData)
+            FlattenProperties(name, visiting);
+    }
+
+    const std::vector<LinaProperty>& HeaderTool::GetFlatProperties(const std::string& nameWithNamespace) const
+    {
+        static const std::vector<LinaProperty> empty;
+        auto                                   it = m_flatProperties.find(nameWithNamespace);
+        return it != m_flatProperties.end() ? it->second : empty;
+    }
+
+    const std::vector<LinaProperty>& HeaderTool::FlattenProperties(const std::string& nameWithNamespace, std::unordered_set<std::string>& visiting)
+    {
+        auto it = m_flatProperties.find(nameWithNamespace);
+        if (it != m_flatProperties.end())
+            return it->second;
+
+        const std::vector<std::string>*  bases      = nullptr;
+        const std::vector<LinaProperty>* properties = nullptr;
+
+        if (auto component = m_componentData.find(nameWithNamespace); component != m_componentData.end())
+        {
+            bases      = &component->second->m_bases;
+            properties = &component->second->m_properties;
+        }
+        else if (auto linaClass = m_classData.find(nameWithNamespace); linaClass != m_classData.end())
+        {
+            bases      = &linaClass->second->m_bases;
+            properties = &linaClass->second->m_properties;
         }
+        else
+            return GetFlatProperties(nameWithNamespace);
 
-        file.close();
+        // Base subobjects precede the derived members and members follow their declaration order,
+        // so base-most properties first gives the list in offset order.
+        std::vector<LinaProperty> flat;
+        visiting.insert(nameWithNamespace);
 
-        std::ofstream newFile;
-        newFile.open(REGISTRY_CPP_PATH, std::ofstream::out | std::ofstream::trunc);
+        for (auto& base : *bases)
+        {
+            const std::string baseName = ResolveBaseName(nameWithNamespace, base);
 
-        for (int i = 0; i < fileContents.size(); i++)
-            newFile << fileContents[i] << std::endl;
-        newFile.close();
+            // Bases that are not reflected, e.g. ECS::Component, contribute nothing.
+            if (baseName.empty() || visiting.count(baseName) != 0)
+                continue;
+
+            const std::vector<LinaProperty>& baseProperties = FlattenProperties(baseName, visiting);
+            flat.insert(flat.end(), baseProperties.begin(), baseProperties.end());
+        }
+
+        visiting.erase(nameWithNamespace);
+
+        // A redeclared member hides the base's one.
+        for (auto& property : *properties)
+        {
+            flat.erase(std::remove_if(flat.begin(), flat.end(), [&](const LinaProperty& inherited) { return inherited.m_propertyName == property.m_propertyName; }), flat.end());
+            flat.push_back(property);
+        }
+
+        return m_flatProperties[nameWithNamespace] = std::move(flat);
+    }
+
+    std::string HeaderTool::ResolveBaseName(const std::string& derived, const std::string& base)
+    {
+        // Looked up like the compiler would, starting in the derived type's namespace and moving outwards.
+        const size_t separator = derived.rfind("::");
+        std::string  space     = separator == std::string::npos ? "" : derived.substr(0, separator);
+
+        while (true)
+        {
+            const std::string candidate = space.empty() ? base : space + "::" + base;
+
+            if (m_componentData.count(candidate) != 0 || m_classData.count(candidate) != 0)
+                return candidate;
+
+            if (space.empty())
+                return m_componentData.count("::" + base) != 0 || m_classData.count("::" + base) != 0 ? "::" + base : "";
+
+            const size_t outer = space.rfind("::");
+            space              = outer == std::string::npos ? "" : space.substr(0, outer);
+        }
+    }
+
+    void HeaderTool::SerializeReadData(const LinaModule& module)
+    {
+        std::ifstream file;
+        file.open(module.m_registryPath);
+
+        if (!file.is_open())
+        {
+            std::cerr << "Lina Header Tool: could not open " << module.m_registryPath << std::endl;
+            return;
+        }
+
+        // Templates with a per-type section get Register_X/Unregister_X functions, older ones register everything inline.
+        // Templates defining the editor props macro get their titles, icons & tooltips wrapped in it, so that they can be stripped.
+        std::string line;
+        m_perType          = false;
+        m_editorPropsMacro = false;
+
+        while (getline(file, line))
+        {
+            m_perType |= line.find(REGISTER_TYPES_BGN_IDENTIFIER) != std::string::npos;
+            m_editorPropsMacro |= line.find("#define " EDITOR_PROPS_MACRO) != std::string::npos;
+        }
+
+        file.clear();
+        file.seekg(0);
+
+        // The template is copied through line by line & generated code is written as it is produced,
+        // so memory use does not grow with the size of the registry.
+        const std::string tempPath = module.m_registryPath + ".tmp";
+        std::vector<char> buffer(WRITE_BUFFER_SIZE);
+        std::ofstream     newFile;
+        newFile.rdbuf()->pubsetbuf(buffer.data(), buffer.size());
+        newFile.open(tempPath, std::ofstream::out | std::ofstream::trunc);
+
+        if (!newFile.is_open())
+        {
+            std::cerr << "Lina Header Tool: could not open " << tempPath << " for writing." << std::endl;
+            return;
+        }
+
+        std::string sectionEnd = "";
+
+        while (getline(file, line))
+        {
+            // Skip the previously generated content until the end of the section.
+            if (!sectionEnd.empty())
+            {
+                if (line.find(sectionEnd) == std::string::npos)
+                    continue;
+
+                sectionEnd = "";
+            }
+
+            newFile << line << '\n';
+
+            if (line.find(INCLUDE_BGN_IDENTIFIER) != std::string::npos)
+            {
+                sectionEnd = INCLUDE_END_IDENTIFIER;
+                WriteIncludes(module, newFile);
+            }
+            else if (line.find(REGISTER_FUNC_BGN_IDENTIFIER) != std::string::npos)
+            {
+                sectionEnd = REGISTER_FUNC_END_IDENTIFIER;
+                WriteRegisterFunction(module, m_perType, newFile);
+            }
+            else if (line.find(REGISTER_TYPES_BGN_IDENTIFIER) != std::string::npos)
+            {
+                sectionEnd = REGISTER_TYPES_END_IDENTIFIER;
+                WriteTypeFunctions(module, newFile);
+            }
+        }
+
+        file.close();
+        newFile.close();
+
+        // A section without its end identifier would swallow the rest of the template, keep the original.
+        if (!sectionEnd.empty() || !newFile.good())
+        {
+            std::cerr << "Lina Header Tool: could not write " << module.m_registryPath << ", missing " << sectionEnd << std::endl;
+            std::error_code err;
+            std::filesystem::remove(tempPath, err);
+            return;
+        }
+
+        ReplaceIfChanged(tempPath, module.m_registryPath);
+    }
+
+    void HeaderTool::WriteIncludes(const LinaModule& module, std::ostream& out)
+    {
+        if (!module.m_headerPath.empty())
+        {
+            const std::filesystem::path registryDir = std::filesystem::path(module.m_registryPath).parent_path();
+            out << "#include \"" << std::filesystem::path(module.m_headerPath).lexically_relative(registryDir).generic_string() << "\"\n";
+        }
+
+        for (auto& include : GetModuleIncludes(module))
+            out << "#include \"" << include << "\"\n";
+    }
+
+    void HeaderTool::WriteRegisterFunction(const LinaModule& module, bool perType, std::ostream& out)
+    {
+        // Lazy builds register each type on its first EnsureRegistered instead.
+        if (perType)
+        {
+            out << "#ifndef LINA_REFLECTION_LAZY\n";
+            out << "uint32_t            count   = 0;\n";
+            out << "ReflectedTypeEntry* entries = " << GetModuleNamespace(module) << "::GetReflectedTypes(count);\n";
+            out << "RegisterReflectedTypes(entries, count);\n";
+            out << "#endif\n";
+            return;
+        }
+
+        WriteStringPool(module, out);
+
+        for (auto* componentData : GetModuleComponents(module))
+            WriteComponentMeta(*componentData, out);
+
+        for (auto* classData : GetModuleClasses(module))
+            WriteClassMeta(*classData, out);
+    }
+
+    void HeaderTool::WriteTypeFunctions(const LinaModule& module, std::ostream& out)
+    {
+        // Hash -> (type name, table entry).
+        std::vector<std::pair<uint32_t, std::pair<std::string, std::string>>> entries;
+        const std::string space = GetModuleNamespace(module);
+
+        auto writeFunctions = [&](const std::string& className, const std::string& include, auto writeMeta) {
+            const std::string functionName = GetFunctionName(className);
+
+            out << "void Register_" << functionName << "()\n{\n";
+            writeMeta();
+            out << "}\n\n";
+            out << "void Unregister_" << functionName << "()\n{\n";
+            out << "entt::meta<" << className << ">().reset();\n";
+            out << "}\n\n";
+
+            const std::string entry = "{" + std::to_string(HashDatabaseString(className.c_str())) + "u, \"" + className + "\", \"" + include + "\", &Register_" + functionName + ", &Unregister_" + functionName + "}";
+            entries.push_back(std::make_pair(HashDatabaseString(className.c_str()), std::make_pair(className, entry)));
+        };
+
+        // Register_X takes the address of functions using the kernel, codec & quantized field tables, which are specialized further down.
+        for (auto* componentData : GetModuleComponents(module))
+        {
+            out << "template <>\nconst ReflectedBulkKernels* GetReflectedBulkKernels<" << componentData->m_nameWithNamespace << ">(uint32_t& count);\n\n";
+            out << "template <>\nconst ReflectedDeltaCodec* GetReflectedDeltaCodec<" << componentData->m_nameWithNamespace << ">();\n\n";
+            out << "template <>\nconst ReflectedQuantizedField* GetReflectedQuantizedFields<" << componentData->m_nameWithNamespace << ">(uint32_t& count);\n\n";
+        }
+
+        // The strings, functions & table of the module live in its own namespace, so that several registries can be linked together.
+        out << "namespace " << space << "\n{\n";
+        WriteStringPool(module, out);
+
+        for (auto* componentData : GetModuleComponents(module))
+            writeFunctions(componentData->m_nameWithNamespace, componentData->m_hppInclude, [&]() { WriteComponentMeta(*componentData, out); });
+
+        for (auto* classData : GetModuleClasses(module))
+            writeFunctions(classData->m_nameWithNamespace, classData->m_hppInclude, [&]() { WriteClassMeta(*classData, out); });
+
+        // Sorted by hash for FindReflectedType's binary search.
+        std::sort(entries.begin(), entries.end());
+
+        if (entries.empty())
+        {
+            out << "ReflectedTypeEntry* GetReflectedTypes(uint32_t& count)\n{\ncount = 0;\nreturn nullptr;\n}\n";
+            out << "} // namespace " << space << "\n";
+            return;
+        }
+
+        out << "static ReflectedTypeEntry s_reflectedTypes[] = {\n";
+        for (auto& entry : entries)
+            out << entry.second.second << ",\n";
+        out << "};\n\n";
+
+        out << "ReflectedTypeEntry* GetReflectedTypes(uint32_t& count)\n{\n";
+        out << "count = static_cast<uint32_t>(sizeof(s_reflectedTypes) / sizeof(s_reflectedTypes[0]));\n";
+        out << "return s_reflectedTypes;\n";
+        out << "}\n";
+        out << "} // namespace " << space << "\n";
+
+        // Typed entry points index the table directly, no lookup on the way.
+        for (size_t i = 0; i < entries.size(); i++)
+            out << "\ntemplate <>\nvoid EnsureRegistered<" << entries[i].second.first << ">()\n{\nEnsureRegistered(" << space << "::s_reflectedTypes[" << i << "]);\n}\n";
+
+        for (auto& entry : entries)
+            WriteReflectedProperties(entry.second.first, out);
+
+        for (auto* componentData : GetModuleComponents(module))
+        {
+            WriteBulkKernels(componentData->m_nameWithNamespace, out);
+            WriteDeltaCodec(componentData->m_nameWithNamespace, out);
+            WriteQuantizedFields(componentData->m_nameWithNamespace, out);
+        }
+
+        if (!module.m_headerPath.empty())
+            WriteComponentFunctions(module, out);
+    }
+
+    void HeaderTool::WriteReflectedProperties(const std::string& className, std::ostream& out)
+    {
+        // Offsets are taken from a prototype & sorted once on first use, inherited properties included.
+        std::vector<std::string> properties;
+
+        if (m_componentData.count(className) != 0)
+            properties.push_back("m_isEnabled");
+
+        for (auto& property : GetFlatProperties(className))
+            properties.push_back(property.m_propertyName);
+
+        out << "\ntemplate <>\nconst ReflectedProperty* GetReflectedProperties<" << className << ">(uint32_t& count)\n{\n";
+        out << "static const std::vector<ReflectedProperty> properties = REF_SortProperties({\n";
+
+        for (auto& property : properties)
+            out << "REF_Property<" << className << ">(\"" << property << "\"_hs, &" << className << "::" << property << "),\n";
+
+        out << "});\n";
+        out << "count = static_cast<uint32_t>(properties.size());\n";
+        out << "return properties.data();\n";
+        out << "}\n";
+    }
+
+    void HeaderTool::WriteBulkKernels(const std::string& className, std::ostream& out)
+    {
+        // Set, add, scale, clamp & min/max over the component's whole storage, one entry per numeric property.
+        std::vector<std::string> properties;
+
+        for (auto& property : GetFlatProperties(className))
+        {
+            if (IsNumericProperty(property))
+                properties.push_back(property.m_propertyName);
+        }
+
+        out << "\ntemplate <>\nconst ReflectedBulkKernels* GetReflectedBulkKernels<" << className << ">(uint32_t& count)\n{\n";
+
+        if (properties.empty())
+        {
+            out << "count = 0;\nreturn nullptr;\n}\n";
+            return;
+        }
+
+        out << "static constexpr ReflectedBulkKernels kernels[] = {\n";
+
+        for (auto& property : properties)
+            out << "REF_BulkKernels<" << className << ", &" << className << "::" << property << ">(\"" << property << "\"_hs),\n";
+
+        out << "};\n";
+        out << "count = static_cast<uint32_t>(sizeof(kernels) / sizeof(kernels[0]));\n";
+        out << "return kernels;\n";
+        out << "}\n";
+    }
+
+    void HeaderTool::WriteDeltaCodec(const std::string& className, std::ostream& out)
+    {
+        // The mask has a bit per field, m_isEnabled first & then the properties in declaration order.
+        out << "\ntemplate <>\nconst ReflectedDeltaCodec* GetReflectedDeltaCodec<" << className << ">()\n{\n";
+        out << "static constexpr ReflectedDeltaCodec codec = REF_DeltaCodec<" << className << ", &" << className << "::m_isEnabled";
+
+        for (auto& property : GetFlatProperties(className))
+            out << ", &" << className << "::" << property.m_propertyName;
+
+        out << ">();\n";
+        out << "return &codec;\n";
+        out << "}\n";
+    }
+
+    void HeaderTool::WriteQuantizedFields(const std::string& className, std::ostream& out)
+    {
+        std::vector<std::string> fields;
+
+        for (auto& property : GetFlatProperties(className))
+        {
+            uint32_t bits = 0;
+            double   min  = 0.0;
+            double   max  = 0.0;
+
+            if (GetQuantization(className, property, min, max, bits, true))
+                fields.push_back("REF_QuantizedField<" + className + ", &" + className + "::" + property.m_propertyName + ">(\"" + property.m_propertyName + "\"_hs, " + FormatDouble(min) + ", " +
+                                 FormatDouble(max) + ", " + std::to_string(bits) + "u)");
+        }
+
+        out << "\ntemplate <>\nconst ReflectedQuantizedField* GetReflectedQuantizedFields<" << className << ">(uint32_t& count)\n{\n";
+
+        if (fields.empty())
+        {
+            out << "count = 0;\nreturn nullptr;\n}\n";
+            return;
+        }
+
+        out << "static constexpr ReflectedQuantizedField fields[] = {\n";
+
+        for (auto& field : fields)
+            out << field << ",\n";
+
+        out << "};\n";
+        out << "count = static_cast<uint32_t>(sizeof(fields) / sizeof(fields[0]));\n";
+        out << "return fields;\n";
+        out << "}\n";
+    }
+
+    void HeaderTool::WriteComponentFunctions(const LinaModule& module, std::ostream& out)
+    {
+        if (m_componentIDs.empty())
+            return;
+
+        // Indexed by the component ID, declared in the component header. Retired IDs get an empty entry.
+        const std::string space = GetModuleNamespace(module);
+        out << "\nnamespace " << space << "\n{\n";
+        out << "constexpr ReflectedComponentFunctions g_reflectedComponentFunctions[REFLECTED_COMPONENT_COUNT] = {\n";
+
+        for (auto* componentData : m_componentIDs)
+        {
+            if (componentData == nullptr)
+            {
+                out << "{}, // retired\n";
+                continue;
+            }
+
+            const std::string& className = componentData->m_nameWithNamespace;
+            const std::string  arguments = GetSectionArguments(className);
+            out << "{&REF_CloneComponent<" << className << ">, &REF_SerializeComponent<" << className << ", " << arguments << ">, &REF_DeserializeComponent<" << className << ", " << arguments
+                << ">, &REF_DeserializeSection<" << className << ", " << arguments << ">, &REF_DeserializeLegacy<" << className << ", " << arguments << ">, &REF_SetEnabled<" << className << ">, &REF_Reset<" << className << ">, &REF_ResetEntities<" << className << ">, &REF_Has<" << className
+                << ">, &REF_Remove<" << className << ">, &GetReflectedProperties<" << className << ">, &REF_FindBulkKernels<" << className << ">, &GetReflectedDeltaCodec<" << className
+                << ">, &REF_CaptureDelta<" << className << ">, &REF_ApplyDeltas<" << className << ">, &GetReflectedQuantizedFields<" << className << ">, &REF_MemoryStats<" << className << ">, ";
+            out << (componentData->m_canAddComponent ? "&REF_Add<" + className + ">" : "nullptr") << "},\n";
+        }
+
+        out << "};\n";
+
+        // Sampled along with the components by SampleReflectedMemoryStats.
+        const std::vector<LinaClass*> pooledClasses = GetPooledClasses(module);
+        if (pooledClasses.empty())
+        {
+            out << "} // namespace " << space << "\n";
+            return;
+        }
+
+        out << "\nconstexpr ReflectedPooledClass g_reflectedPooledClasses[REFLECTED_POOLED_CLASS_COUNT] = {\n";
+
+        for (auto* classData : pooledClasses)
+        {
+            const std::string& className = classData->m_nameWithNamespace;
+            out << "{" << HashDatabaseString(className.c_str()) << "u, \"" << className << "\", &REF_MemoryStats<" << className << ">},\n";
+        }
+
+        out << "};\n";
+        out << "} // namespace " << space << "\n";
+    }
+
+    void HeaderTool::WriteStringPool(const LinaModule& module, std::ostream& out)
+    {
+        // Every title, category, type & tooltip is stored once in a single blob, props point into it.
+        m_metaStrings = StringPool();
+
+        for (auto* componentData : GetModuleComponents(module))
+        {
+            AddMetaString(componentData->m_title);
+            AddMetaString(componentData->m_category);
+
+            for (auto& property : GetFlatProperties(componentData->m_nameWithNamespace))
+            {
+                AddMetaString(property.m_title);
+                AddMetaString(property.m_type);
+                AddMetaString(property.m_tooltip);
+            }
+        }
+
+        for (auto* classData : GetModuleClasses(module))
+        {
+            AddMetaString(classData->m_title);
+
+            for (auto& property : GetFlatProperties(classData->m_nameWithNamespace))
+            {
+                AddMetaString(property.m_title);
+                AddMetaString(property.m_type);
+                AddMetaString(property.m_tooltip);
+            }
+        }
+
+        const std::string& data = m_metaStrings.GetData();
+        out << "[[maybe_unused]] static constexpr char s_reflectionStrings[] =\n";
+
+        for (size_t offset = 0; offset < data.size();)
+        {
+            const size_t end = data.find('\0', offset);
+            out << "/* " << offset << " */ \"" << EscapeStringLiteral(data.substr(offset, end - offset)) << "\\0\"\n";
+            offset = end + 1;
+        }
+
+        out << ";\n\n";
+    }
+
+    void HeaderTool::AddMetaString(const std::string& str)
+    {
+        // Strings are kept unescaped, so offsets count the characters of the compiled pool.
+        m_metaStrings.Add(str);
+    }
+
+    std::string HeaderTool::GetMetaString(const std::string& str)
+    {
+        return "&s_reflectionStrings[" + std::to_string(m_metaStrings.Add(str)) + "]";
+    }
+
+    void HeaderTool::WriteComponentMeta(const LinaComponent& componentData, std::ostream& out)
+    {
+        const std::string& className = componentData.m_nameWithNamespace;
+
+        // Class meta.
+        out << "entt::meta<" << className << ">().type()";
+        WriteProps("std::make_pair(\"Category\"_hs," + GetMetaString(componentData.m_category) + ")", "std::make_pair(\"Title\"_hs, " + GetMetaString(componentData.m_title) + "), std::make_pair(\"Icon\"_hs," + componentData.m_icon + ")", out);
+        out << ";\n";
+
+        // inherited m_isEnabled
+        out << "entt::meta<" << className << ">().data<&" << className << "::m_isEnabled>(\"m_isEnabled\"_hs);\n";
+
+        // Properties of reflected bases are registered on the derived type as well.
+        for (auto& property : GetFlatProperties(className))
+            WriteProperty(className, property, out);
+
+        out << "entt::meta<" << className << ">().func<&REF_CloneComponent<" << className << ">, entt::as_void_t>(\"clone\"_hs);\n";
+        out << "entt::meta<" << className << ">().func<&REF_SerializeComponent<" << className << ", " << GetSectionArguments(className) << ">, entt::as_void_t>(\"serialize\"_hs);\n";
+        out << "entt::meta<" << className << ">().func<&REF_DeserializeComponent<" << className << ", " << GetSectionArguments(className) << ">, entt::as_void_t>(\"deserialize\"_hs);\n";
+        out << "entt::meta<" << className << ">().func<&REF_DeserializeSection<" << className << ", " << GetSectionArguments(className) << ">>(\"deserializeSection\"_hs);\n";
+        out << "entt::meta<" << className << ">().func<&REF_DeserializeLegacy<" << className << ", " << GetSectionArguments(className) << ">, entt::as_void_t>(\"deserializeLegacy\"_hs);\n";
+        out << "entt::meta<" << className << ">().func<&REF_SetEnabled<" << className << ">, entt::as_void_t>(\"setEnabled\"_hs);\n";
+        out << "entt::meta<" << className << ">().func<&REF_Get<" << className << ">, entt::as_ref_t>(\"get\"_hs);\n";
+        out << "entt::meta<" << className << ">().func<&REF_Reset<" << className << ">, entt::as_void_t>(\"reset\"_hs);\n";
+        out << "entt::meta<" << className << ">().func<&REF_ResetEntities<" << className << ">, entt::as_void_t>(\"resetEntities\"_hs);\n";
+        out << "entt::meta<" << className << ">().func<&REF_Has<" << className << ">, entt::as_void_t>(\"has\"_hs);\n";
+        out << "entt::meta<" << className << ">().func<&REF_Remove<" << className << ">, entt::as_void_t>(\"remove\"_hs);\n";
+        out << "entt::meta<" << className << ">().func<&REF_Copy<" << className << ">, entt::as_void_t>(\"copy\"_hs);\n";
+        out << "entt::meta<" << className << ">().func<&REF_Paste<" << className << ">, entt::as_void_t>(\"paste\"_hs);\n";
+        out << "entt::meta<" << className << ">().func<&REF_MemoryStats<" << className << ">>(\"memstats\"_hs);\n";
+
+        // Kernels are only generated along with the per-type functions.
+        if (m_perType)
+        {
+            out << "entt::meta<" << className << ">().func<&REF_FindBulkKernels<" << className << ">>(\"bulk\"_hs);\n";
+            out << "entt::meta<" << className << ">().func<&REF_CaptureDelta<" << className << ">>(\"captureDelta\"_hs);\n";
+            out << "entt::meta<" << className << ">().func<&REF_ApplyDeltas<" << className << ">>(\"applyDeltas\"_hs);\n";
+        }
+
+        if (componentData.m_canAddComponent)
+            out << "entt::meta<" << className << ">().func<&REF_Add<" << className << ">, entt::as_void_t>(\"add\"_hs);\n";
+
+        if (componentData.m_listenToValueChanged)
+            out << "entt::meta<" << className << ">().func<&REF_ValueChanged<" << className << ">, entt::as_void_t>(\"add\"_hs);\n";
+    }
+
+    void HeaderTool::WriteClassMeta(const LinaClass& classData, std::ostream& out)
+    {
+        const std::string& className = classData.m_nameWithNamespace;
+        out << "entt::meta<" << className << ">().type()";
+        WriteProps("", "\"Title\"_hs, " + GetMetaString(classData.m_title), out);
+        out << ";\n";
+
+        for (auto& property : GetFlatProperties(className))
+            WriteProperty(className, property, out);
+
+        // Classes living in ECS pools without being components, e.g. EntityDataComponent, still report their pool.
+        if (IsPooledClass(classData))
+            out << "entt::meta<" << className << ">().func<&REF_MemoryStats<" << className << ">>(\"memstats\"_hs);\n";
+    }
+
+    std::vector<LinaClass*> HeaderTool::GetPooledClasses(const LinaModule& module)
+    {
+        std::vector<LinaClass*> pooledClasses = GetModuleClasses(module);
+        pooledClasses.erase(std::remove_if(pooledClasses.begin(), pooledClasses.end(), [&](LinaClass* classData) { return !IsPooledClass(*classData); }), pooledClasses.end());
+        return pooledClasses;
+    }
+
+    bool HeaderTool::IsPooledClass(const LinaClass& classData)
+    {
+        for (auto& base : classData.m_bases)
+        {
+            if (base == "Component" || (base.size() > 11 && base.compare(base.size() - 11, 11, "::Component") == 0))
+                return true;
+
+            const std::string baseName = ResolveBaseName(classData.m_nameWithNamespace, base);
+
+            if (m_componentData.count(baseName) != 0)
+                return true;
+        }
+
+        return false;
+    }
+
+    bool HeaderTool::IsQuantizedInSections(const std::string& className, const LinaProperty& property)
+    {
+        // Ranged fields are bit-packed through GetReflectedQuantizedFields, which only exists along with the per-type functions.
+        double   min  = 0.0;
+        double   max  = 0.0;
+        uint32_t bits = 0;
+        return m_perType && GetQuantization(className, property, min, max, bits, false);
+    }
+
+    uint32_t HeaderTool::GetSchemaHash(const std::string& className)
+    {
+        // Covers the reflected layout: m_isEnabled & every other property, inherited ones included, by name & C++ type in that
+        // order, then the ranged properties along with their range & bits. This is exactly what the payload of a component
+        // without its own serialization archives, a component's serialize member is not covered.
+        std::string schema    = className + "|m_isEnabled:bool";
+        std::string quantized = "";
+
+        for (auto& property : GetFlatProperties(className))
+        {
+            double   min  = 0.0;
+            double   max  = 0.0;
+            uint32_t bits = 0;
+
+            if (m_perType && GetQuantization(className, property, min, max, bits, false))
+                quantized += "|" + property.m_propertyName + ":" + property.m_memberType + "@" + FormatDouble(min) + "," + FormatDouble(max) + "," + std::to_string(bits);
+            else
+                schema += "|" + property.m_propertyName + ":" + property.m_memberType;
+        }
+
+        schema += quantized;
+        return HashDatabaseString(schema.c_str());
+    }
+
+    std::string HeaderTool::GetSectionArguments(const std::string& className)
+    {
+        // Template arguments of the section functions: type hash, schema hash, and for components cereal can not archive on
+        // their own, whether ranged properties are bit-packed & the other archived members in the order the schema hash covers, e.g.
+        // "2854129345u, 1180324051u, false, &ECS::LightComponent::m_isEnabled, &ECS::LightComponent::m_color".
+        std::string members   = "&" + className + "::m_isEnabled";
+        bool        quantized = false;
+
+        for (auto& property : GetFlatProperties(className))
+        {
+            if (IsQuantizedInSections(className, property))
+                quantized = true;
+            else
+                members += ", &" + className + "::" + property.m_propertyName;
+        }
+
+        return std::to_string(HashDatabaseString(className.c_str())) + "u, " + std::to_string(GetSchemaHash(className)) + "u, " + (quantized ? "true, " : "false, ") + members;
+    }
+
+    bool HeaderTool::GetQuantization(const std::string& className, const LinaProperty& property, double& min, double& max, uint32_t& bits, bool report)
+    {
+        if (property.m_range.empty())
+            return false;
+
+        // "min, max, precision", precision being the largest error allowed after decoding.
+        double      precision = 0.0;
+        std::string error     = "";
+
+        if (!ParseQuantizationRange(property.m_range, min, max, precision, error))
+        {
+            if (report)
+                std::cerr << "Lina Header Tool: invalid range \"" << property.m_range << "\" of " << className << "::" << property.m_propertyName << " (" << error << "), expected \"min, max, precision\"." << std::endl;
+            return false;
+        }
+
+        if (property.m_type.compare("Float") != 0 && property.m_type.compare("Double") != 0)
+        {
+            if (report)
+                std::cerr << "Lina Header Tool: only Float & Double properties can be quantized, ignoring the range of " << className << "::" << property.m_propertyName << std::endl;
+            return false;
+        }
+
+        bits = GetQuantizationBits(min, max, precision);
+
+        if (bits == 0)
+        {
+            if (report)
+                std::cerr << "Lina Header Tool: range of " << className << "::" << property.m_propertyName << " needs more than 32 bits, ignoring it." << std::endl;
+            return false;
+        }
+
+        return true;
+    }
+
+    std::string HeaderTool::FormatDouble(double value)
+    {
+        // Round trips exactly & always reads as a floating point literal.
+        std::ostringstream stream;
+        stream.precision(17);
+        stream << value;
+
+        const std::string str = stream.str();
+        return str.find_first_of(".e") == std::string::npos ? str + ".0" : str;
+    }
+
+    bool HeaderTool::IsNumericProperty(const LinaProperty& property)
+    {
+        return property.m_type.compare("Float") == 0 || property.m_type.compare("Double") == 0 || property.m_type.compare("Int") == 0 || property.m_type.compare("Uint") == 0;
+    }
+
+    std::string HeaderTool::GetFunctionName(const std::string& nameWithNamespace)
+    {
+        // ECS::LightComponent -> ECS_LightComponent
+        std::string name = nameWithNamespace;
+        for (size_t pos = name.find("::"); pos != std::string::npos; pos = name.find("::", pos))
+            name.replace(pos, 2, "_");
+        return name;
+    }
+
+    std::string HeaderTool::GetModuleNamespace(const LinaModule& module)
+    {
+        // LinaEngine -> LinaEngineReflection, my-game -> my_gameReflection
+        std::string name = module.m_name;
+        for (auto& c : name)
+        {
+            if (!std::isalnum(static_cast<unsigned char>(c)))
+                c = '_';
+        }
+
+        if (!name.empty() && std::isdigit(static_cast<unsigned char>(name[0])))
+            name = "_" + name;
+
+        return name + "Reflection";
+    }
+
+    void HeaderTool::WriteProperty(const std::string& className, const LinaProperty& property, std::ostream& out)
+    {
+        out << "entt::meta<" << className << ">().data<&" << className << "::" << property.m_propertyName << ">(\"" << property.m_propertyName << "\"_hs)";
+        WriteProps("std::make_pair(\"Type\"_hs," + GetMetaString(property.m_type) + "),std::make_pair(\"Depends\"_hs,\"" + EscapeStringLiteral(property.m_dependsOn) + "\"_hs)", "std::make_pair(\"Title\"_hs," + GetMetaString(property.m_title) + "),std::make_pair(\"Tooltip\"_hs," + GetMetaString(property.m_tooltip) + ")", out);
+        out << ";\n";
+    }
+
+    void HeaderTool::WriteProps(const std::string& runtimeProps, const std::string& editorProps, std::ostream& out)
+    {
+        // Types, dependencies & categories are read at runtime, the macro only drops titles, tooltips & icons from builds that do not define LINA_EDITOR.
+        if (!m_editorPropsMacro)
+        {
+            out << ".props(" << runtimeProps << (runtimeProps.empty() ? "" : ", ") << editorProps << ")";
+            return;
+        }
+
+        if (!runtimeProps.empty())
+            out << ".props(" << runtimeProps << ")";
+
+        out << " " EDITOR_PROPS_MACRO "(" << editorProps << ")";
+    }
+
+    void HeaderTool::ReplaceIfChanged(const std::string& tempPath, const std::string& path)
+    {
+        // Compare in fixed size chunks, an unchanged output keeps its timestamp and does not trigger a rebuild.
+        std::ifstream newFile, oldFile;
+        newFile.open(tempPath, std::ifstream::in | std::ifstream::binary);
+        oldFile.open(path, std::ifstream::in | std::ifstream::binary);
+
+        bool changed = !oldFile.is_open();
+
+        if (!changed)
+        {
+            std::vector<char> newChunk(WRITE_BUFFER_SIZE), oldChunk(WRITE_BUFFER_SIZE);
+
+            while (!changed)
+            {
+                newFile.read(newChunk.data(), newChunk.size());
+                oldFile.read(oldChunk.data(), oldChunk.size());
+
+                const std::streamsize newCount = newFile.gcount();
+                changed                        = newCount != oldFile.gcount() || std::memcmp(newChunk.data(), oldChunk.data(), static_cast<size_t>(newCount)) != 0;
+
+                if (newCount == 0)
+                    break;
+            }
+        }
+
+        newFile.close();
+        oldFile.close();
+
+        std::error_code err;
+
+        if (!changed)
+        {
+            std::filesystem::remove(tempPath, err);
+            return;
+        }
+
+        std::filesystem::rename(tempPath, path, err);
+
+        if (err)
+        {
+            std::cerr << "Lina Header Tool: could not replace " << path << ", " << err.message() << std::endl;
+            std::filesystem::remove(tempPath, err);
+        }
+    }
+
+    std::vector<LinaComponent*> HeaderTool::GetModuleComponents(const LinaModule& module)
+    {
+        std::vector<LinaComponent*> components;
+
+        for (auto& [actualName, compData] : m_componentData)
+        {
+            if (IsInModule(compData->m_hppPath, module))
+                components.push_back(compData);
+        }
+
+        // Sort so that the output is stable between runs.
+        std::sort(components.begin(), components.end(), [](LinaComponent* a, LinaComponent* b) { return a->m_nameWithNamespace < b->m_nameWithNamespace; });
+        return components;
+    }
+
+    std::vector<LinaClass*> HeaderTool::GetModuleClasses(const LinaModule& module)
+    {
+        std::vector<LinaClass*> classes;
+
+        for (auto& [actualName, classData] : m_classData)
+        {
+            if (IsInModule(classData->m_hppPath, module))
+                classes.push_back(classData);
+        }
+
+        std::sort(classes.begin(), classes.end(), [](LinaClass* a, LinaClass* b) { return a->m_nameWithNamespace < b->m_nameWithNamespace; });
+        return classes;
+    }
+
+    void HeaderTool::SerializeDatabase(const LinaModule& module)
+    {
+        const std::vector<LinaComponent*> components = GetModuleComponents(module);
+        const std::vector<LinaClass*>     classes    = GetModuleClasses(module);
+
+        StringPool                      stringPool;
+        std::vector<DatabaseType>       types;
+        std::vector<DatabaseProperty>   properties;
+        std::vector<DatabaseIndexEntry> typeIndex;
+        std::vector<DatabaseIndexEntry> propertyIndex;
+
+        auto addProperties = [&](DatabaseType& type, const std::vector<LinaProperty>& typeProperties) {
+            type.m_firstProperty = static_cast<uint32_t>(properties.size());
+            type.m_propertyCount = static_cast<uint32_t>(typeProperties.size());
+
+            for (auto& property : typeProperties)
+            {
+                DatabaseProperty dbProperty;
+                dbProperty.m_hash      = HashDatabaseString(property.m_propertyName.c_str());
+                dbProperty.m_name      = stringPool.Add(property.m_propertyName);
+                dbProperty.m_title     = stringPool.Add(property.m_title);
+                dbProperty.m_type      = stringPool.Add(property.m_type);
+                dbProperty.m_tooltip   = stringPool.Add(property.m_tooltip);
+                dbProperty.m_dependsOn = stringPool.Add(property.m_dependsOn);
+                propertyIndex.push_back({dbProperty.m_hash, static_cast<uint32_t>(properties.size())});
+                properties.push_back(dbProperty);
+            }
+
+            std::sort(propertyIndex.begin() + type.m_firstProperty, propertyIndex.end(), [](const DatabaseIndexEntry& a, const DatabaseIndexEntry& b) { return a.m_hash < b.m_hash; });
+            typeIndex.push_back({type.m_hash, static_cast<uint32_t>(types.size())});
+            types.push_back(type);
+        };
+
+        for (auto* componentData : components)
+        {
+            DatabaseType type;
+            type.m_hash              = HashDatabaseString(componentData->m_nameWithNamespace.c_str());
+            type.m_name              = stringPool.Add(componentData->m_name);
+            type.m_nameWithNamespace = stringPool.Add(componentData->m_nameWithNamespace);
+            type.m_include           = stringPool.Add(componentData->m_hppInclude);
+            type.m_title             = stringPool.Add(componentData->m_title);
+            type.m_icon              = stringPool.Add(componentData->m_icon);
+            type.m_category          = stringPool.Add(componentData->m_category);
+            type.m_flags             = DB_TYPE_COMPONENT;
+
+            if (componentData->m_canAddComponent)
+                type.m_flags |= DB_TYPE_CAN_ADD_COMPONENT;
+
+            if (componentData->m_listenToValueChanged)
+                type.m_flags |= DB_TYPE_LISTEN_TO_VALUE_CHANGE;
+
+            addProperties(type, GetFlatProperties(componentData->m_nameWithNamespace));
+        }
+
+        for (auto* classData : classes)
+        {
+            DatabaseType type;
+            type.m_hash              = HashDatabaseString(classData->m_nameWithNamespace.c_str());
+            type.m_name              = stringPool.Add(classData->m_name);
+            type.m_nameWithNamespace = stringPool.Add(classData->m_nameWithNamespace);
+            type.m_include           = stringPool.Add(classData->m_hppInclude);
+            type.m_title             = stringPool.Add(classData->m_title);
+            addProperties(type, GetFlatProperties(classData->m_nameWithNamespace));
+        }
+
+        std::sort(typeIndex.begin(), typeIndex.end(), [](const DatabaseIndexEntry& a, const DatabaseIndexEntry& b) { return a.m_hash < b.m_hash; });
+
+        // Pad the string pool so the file size stays 4 byte aligned.
+        std::string pool = stringPool.GetData();
+        pool.resize((pool.size() + 3) & ~size_t(3), '\0');
+
+        DatabaseHeader header;
+        header.m_typeCount           = static_cast<uint32_t>(types.size());
+        header.m_propertyCount       = static_cast<uint32_t>(properties.size());
+        header.m_typeTableOffset     = sizeof(DatabaseHeader);
+        header.m_propertyTableOffset = header.m_typeTableOffset + static_cast<uint32_t>(types.size() * sizeof(DatabaseType));
+        header.m_typeIndexOffset     = header.m_propertyTableOffset + static_cast<uint32_t>(properties.size() * sizeof(DatabaseProperty));
+        header.m_propertyIndexOffset = header.m_typeIndexOffset + static_cast<uint32_t>(typeIndex.size() * sizeof(DatabaseIndexEntry));
+        header.m_stringPoolOffset    = header.m_propertyIndexOffset + static_cast<uint32_t>(propertyIndex.size() * sizeof(DatabaseIndexEntry));
+        header.m_stringPoolSize      = static_cast<uint32_t>(pool.size());
+        header.m_fileSize            = header.m_stringPoolOffset + header.m_stringPoolSize;
+
+        const std::string tempPath = module.m_databasePath + ".tmp";
+        std::ofstream     file;
+        file.open(tempPath, std::ofstream::out | std::ofstream::trunc | std::ofstream::binary);
+
+        if (!file.is_open())
+        {
+            std::cerr << "Lina Header Tool: could not open " << tempPath << " for writing." << std::endl;
+            return;
+        }
+
+        file.write(reinterpret_cast<const char*>(&header), sizeof(DatabaseHeader));
+        file.write(reinterpret_cast<const char*>(types.data()), types.size() * sizeof(DatabaseType));
+        file.write(reinterpret_cast<const char*>(properties.data()), properties.size() * sizeof(DatabaseProperty));
+        file.write(reinterpret_cast<const char*>(typeIndex.data()), typeIndex.size() * sizeof(DatabaseIndexEntry));
+        file.write(reinterpret_cast<const char*>(propertyIndex.data()), propertyIndex.size() * sizeof(DatabaseIndexEntry));
+        file.write(pool.data(), pool.size());
+        file.close();
+        ReplaceIfChanged(tempPath, module.m_databasePath);
+    }
+
+    void HeaderTool::AssignComponentIDs(const LinaModule& module)
+    {
+        const std::vector<LinaComponent*> components = GetModuleComponents(module);
+
+        // Every ID ever handed out stays reserved for its component, so removing a component never renumbers the others.
+        // Removed components are kept as retired entries & get their ID back if they return. New components fill the
+        // unreserved slots first, then append, in sorted order.
+        std::vector<std::string> reserved;
+        std::ifstream            file;
+
+        if (!module.m_idsPath.empty())
+            file.open(module.m_idsPath);
+
+        std::string line;
+        size_t      lineNumber = 0;
+        while (file.is_open() && getline(file, line))
+        {
+            lineNumber++;
+            if (line.empty() || line[0] == '#')
+                continue;
+
+            const size_t separator = line.rfind(' ');
+            if (separator == std::string::npos)
+                continue;
+
+            char*               end = nullptr;
+            const unsigned long id  = std::isdigit(static_cast<unsigned char>(line[0])) ? std::strtoul(line.c_str(), &end, 10) : 0;
+
+            if (end == nullptr || *end != ' ' || id > MAX_COMPONENT_ID)
+            {
+                std::cerr << "Lina Header Tool: ignoring line " << lineNumber << " of " << module.m_idsPath << ", expected an ID up to " << MAX_COMPONENT_ID << " followed by a component name." << std::endl;
+                continue;
+            }
+
+            if (id >= reserved.size())
+                reserved.resize(id + 1);
+
+            if (reserved[id].empty())
+                reserved[id] = line.substr(separator + 1);
+        }
+
+        m_componentIDs.assign(reserved.size(), nullptr);
+        std::vector<LinaComponent*> unassigned;
+
+        for (auto* componentData : components)
+        {
+            auto it = std::find(reserved.begin(), reserved.end(), componentData->m_nameWithNamespace);
+
+            if (it != reserved.end())
+                m_componentIDs[it - reserved.begin()] = componentData;
+            else
+                unassigned.push_back(componentData);
+        }
+
+        size_t freeSlot = 0;
+        for (auto* componentData : unassigned)
+        {
+            while (freeSlot < reserved.size() && !reserved[freeSlot].empty())
+                freeSlot++;
+
+            if (freeSlot < reserved.size())
+                reserved[freeSlot] = componentData->m_nameWithNamespace;
+            else
+            {
+                reserved.push_back(componentData->m_nameWithNamespace);
+                m_componentIDs.push_back(nullptr);
+            }
+
+            m_componentIDs[freeSlot] = componentData;
+        }
+
+        if (module.m_idsPath.empty())
+            return;
+
+        std::string contents = "# Stable component IDs of the reflection registry, generated by Lina Header Tool. Keep under version control.\n";
+        contents += "# Retired IDs stay reserved for their removed component, delete a retired line to release its ID.\n";
+        for (size_t i = 0; i < m_componentIDs.size(); i++)
+        {
+            if (!reserved[i].empty())
+                contents += std::to_string(i) + (m_componentIDs[i] == nullptr ? " retired " : " ") + reserved[i] + "\n";
+        }
+
+        WriteIfChanged(contents, module.m_idsPath);
+    }
+
+    void HeaderTool::SerializeComponentHeader(const LinaModule& module)
+    {
+        std::string contents;
+        contents += "// Stable component IDs & dispatch table of the reflection registry, generated by Lina Header Tool, do not modify.\n";
+        contents += "#pragma once\n\n";
+        contents += "#include \"Core/CommonECS.hpp\"\n";
+        contents += "#include \"ReflectedTypeTable.hpp\"\n";
+        contents += "#include <bitset>\n";
+        contents += "#include <cereal/archives/portable_binary.hpp>\n";
+        contents += "#include <cstdint>\n";
+        contents += "#include <entt/entity/snapshot.hpp>\n";
+        contents += "#include <istream>\n";
+        contents += "#include <vector>\n\n";
+
+        // Forward declarations, grouped by namespace.
+        std::map<std::string, std::vector<LinaComponent*>> namespaces;
+        for (auto* componentData : GetModuleComponents(module))
+        {
+            const size_t separator = componentData->m_nameWithNamespace.rfind("::");
+            namespaces[componentData->m_nameWithNamespace.substr(0, separator)].push_back(componentData);
+        }
+
+        for (auto& [space, components] : namespaces)
+        {
+            contents += space.empty() ? "namespace Lina\n{\n" : "namespace Lina::" + space + "\n{\n";
+            for (auto* componentData : components)
+                contents += std::string("    ") + (componentData->m_isStruct ? "struct " : "class ") + componentData->m_name + ";\n";
+            contents += "}\n\n";
+        }
+
+        const std::string             count         = std::to_string(m_componentIDs.size());
+        const std::vector<LinaClass*> pooledClasses = GetPooledClasses(module);
+        const std::string             space         = GetModuleNamespace(module);
+        contents += "namespace Lina\n{\n";
+
+        // Declared here so that every translation unit sees the registry's specializations.
+        for (auto* componentData : GetModuleComponents(module))
+        {
+            contents += "    template <>\n    const ReflectedProperty* GetReflectedProperties<" + componentData->m_nameWithNamespace + ">(uint32_t& count);\n\n";
+            contents += "    template <>\n    const ReflectedBulkKernels* GetReflectedBulkKernels<" + componentData->m_nameWithNamespace + ">(uint32_t& count);\n\n";
+            contents += "    template <>\n    const ReflectedDeltaCodec* GetReflectedDeltaCodec<" + componentData->m_nameWithNamespace + ">();\n\n";
+            contents += "    template <>\n    const ReflectedQuantizedField* GetReflectedQuantizedFields<" + componentData->m_nameWithNamespace + ">(uint32_t& count);\n\n";
+        }
+
+        // Shared by the headers of every module, the first one included defines them.
+        contents += "#ifndef LINA_REFLECTED_COMPONENT_TYPES\n";
+        contents += "#define LINA_REFLECTED_COMPONENT_TYPES\n";
+        contents += "\n    struct ReflectedComponentFunctions\n";
+        contents += "    {\n";
+        contents += "        void (*m_clone)(ECS::Entity from, ECS::Entity to);\n";
+        contents += "        void (*m_serialize)(entt::snapshot& snapshot, cereal::PortableBinaryOutputArchive& archive);\n";
+        contents += "        void (*m_deserialize)(entt::snapshot_loader& loader, cereal::PortableBinaryInputArchive& archive); // Drops sections of another type or schema.\n";
+        contents += "        ReflectedSectionResult (*m_deserializeSection)(std::istream& stream, entt::snapshot_loader& loader, cereal::PortableBinaryInputArchive& archive); // stream is the archive's.\n";
+        contents += "        void (*m_deserializeLegacy)(entt::snapshot_loader& loader, cereal::PortableBinaryInputArchive& archive); // Levels saved without sections.\n";
+        contents += "        void (*m_setEnabled)(ECS::Entity entity, bool enabled);\n";
+        contents += "        void (*m_reset)(ECS::Entity entity);\n";
+        contents += "        void (*m_resetEntities)(const ECS::Entity* entities, uint32_t count);\n";
+        contents += "        bool (*m_has)(ECS::Entity entity);\n";
+        contents += "        void (*m_remove)(ECS::Entity entity);\n";
+        contents += "        const ReflectedProperty* (*m_properties)(uint32_t& count);\n";
+        contents += "        const ReflectedBulkKernels* (*m_bulkKernels)(uint32_t propertyHash); // nullptr if the property is not numeric.\n";
+        contents += "        const ReflectedDeltaCodec* (*m_deltaCodec)();\n";
+        contents += "        bool (*m_captureDelta)(ECS::Entity entity, const void* baseline, std::vector<uint8_t>& out); // nullptr baseline for the defaults.\n";
+        contents += "        size_t (*m_applyDeltas)(const uint8_t* data, size_t size); // Returns the number of records applied.\n";
+        contents += "        const ReflectedQuantizedField* (*m_quantizedFields)(uint32_t& count);\n";
+        contents += "        ReflectedMemoryStats (*m_memoryStats)();\n";
+        contents += "        void (*m_add)(ECS::Entity entity); // nullptr if the component can not be added from the editor.\n";
+        contents += "    };\n";
+
+        contents += "\n    struct ReflectedPooledClass\n";
+        contents += "    {\n";
+        contents += "        uint32_t m_typeHash;\n";
+        contents += "        const char* m_name;\n";
+        contents += "        ReflectedMemoryStats (*m_memoryStats)();\n";
+        contents += "    };\n";
+
+        contents += "\n    // Serialized components are written as sections: type hash, schema hash, payload size & the payload itself.\n";
+        contents += "    struct ReflectedSection\n";
+        contents += "    {\n";
+        contents += "        uint32_t m_typeHash   = 0;\n";
+        contents += "        uint32_t m_schemaHash = 0;\n";
+        contents += "        uint64_t m_size       = 0;\n";
+        contents += "    };\n\n";
+        contents += "    constexpr std::streamoff REFLECTED_SECTION_HEADER_SIZE = 16;\n\n";
+        contents += "    // Reads the header of the next section & rewinds, so the section can still be deserialized or skipped.\n";
+        contents += "    inline ReflectedSection PeekSection(std::istream& stream, cereal::PortableBinaryInputArchive& archive)\n";
+        contents += "    {\n";
+        contents += "        ReflectedSection section;\n";
+        contents += "        archive(section.m_typeHash, section.m_schemaHash, section.m_size);\n";
+        contents += "        stream.seekg(-REFLECTED_SECTION_HEADER_SIZE, std::ios::cur);\n";
+        contents += "        return section;\n";
+        contents += "    }\n\n";
+        contents += "    // Moves past the next section without decoding its payload.\n";
+        contents += "    inline void SkipSection(std::istream& stream, cereal::PortableBinaryInputArchive& archive)\n";
+        contents += "    {\n";
+        contents += "        const ReflectedSection section = PeekSection(stream, archive);\n";
+        contents += "        stream.seekg(REFLECTED_SECTION_HEADER_SIZE + static_cast<std::streamoff>(section.m_size), std::ios::cur);\n";
+        contents += "    }\n";
+        contents += "#endif\n";
+        contents += "} // namespace Lina\n\n";
+
+        // Everything generated for the module itself, named after it so that the registries of several modules can be linked together.
+        contents += "namespace Lina::" + space + "\n{\n";
+        contents += "    constexpr uint32_t REFLECTED_COMPONENT_COUNT = " + count + ";\n\n";
+        contents += "    // Reflected classes living in ECS pools without being components, e.g. EntityDataComponent.\n";
+        contents += "    constexpr uint32_t REFLECTED_POOLED_CLASS_COUNT = " + std::to_string(pooledClasses.size()) + ";\n\n";
+        contents += "    // One bit per reflected component, indexed by its ID.\n";
+        contents += "    typedef std::bitset<REFLECTED_COMPONENT_COUNT> ReflectedComponentMask;\n\n";
+        contents += "    template <typename T>\n";
+        contents += "    struct ReflectedComponentID;\n";
+
+        for (size_t i = 0; i < m_componentIDs.size(); i++)
+        {
+            if (m_componentIDs[i] == nullptr)
+                continue;
+
+            contents += "\n    template <>\n";
+            contents += "    struct ReflectedComponentID<" + m_componentIDs[i]->m_nameWithNamespace + ">\n";
+            contents += "    {\n";
+            contents += "        static constexpr uint32_t value = " + std::to_string(i) + ";\n";
+            contents += "    };\n";
+        }
+
+        contents += "\n    // Defined by the registry, returns the module's type table & its size, see ReflectedTypeTable.hpp.\n";
+        contents += "    ReflectedTypeEntry* GetReflectedTypes(uint32_t& count);\n\n";
+        contents += "    inline ReflectedTypeEntry* FindReflectedType(uint32_t hash)\n";
+        contents += "    {\n";
+        contents += "        uint32_t            count   = 0;\n";
+        contents += "        ReflectedTypeEntry* entries = GetReflectedTypes(count);\n";
+        contents += "        return Lina::FindReflectedType(entries, count, hash);\n";
+        contents += "    }\n\n";
+        contents += "    inline bool EnsureRegistered(uint32_t hash)\n";
+        contents += "    {\n";
+        contents += "        uint32_t            count   = 0;\n";
+        contents += "        ReflectedTypeEntry* entries = GetReflectedTypes(count);\n";
+        contents += "        return Lina::EnsureRegistered(entries, count, hash);\n";
+        contents += "    }\n\n";
+        contents += "    inline bool UnregisterReflectedType(uint32_t hash)\n";
+        contents += "    {\n";
+        contents += "        uint32_t            count   = 0;\n";
+        contents += "        ReflectedTypeEntry* entries = GetReflectedTypes(count);\n";
+        contents += "        return Lina::UnregisterReflectedType(entries, count, hash);\n";
+        contents += "    }\n\n";
+        contents += "    inline void RegisterReflectedTypes()\n";
+        contents += "    {\n";
+        contents += "        uint32_t            count   = 0;\n";
+        contents += "        ReflectedTypeEntry* entries = GetReflectedTypes(count);\n";
+        contents += "        Lina::RegisterReflectedTypes(entries, count);\n";
+        contents += "    }\n\n";
+        contents += "    inline uint32_t ReregisterReflectedHeader(const char* include)\n";
+        contents += "    {\n";
+        contents += "        uint32_t            count   = 0;\n";
+        contents += "        ReflectedTypeEntry* entries = GetReflectedTypes(count);\n";
+        contents += "        return Lina::ReregisterReflectedHeader(entries, count, include);\n";
+        contents += "    }\n";
+
+        if (!m_componentIDs.empty())
+        {
+            std::string typeHashes = "";
+            std::string schemas    = "";
+
+            for (auto* componentData : m_componentIDs)
+            {
+                if (componentData == nullptr)
+                {
+                    typeHashes += "        0u, // retired\n";
+                    schemas += "        0u,\n";
+                    continue;
+                }
+
+                typeHashes += "        " + std::to_string(HashDatabaseString(componentData->m_nameWithNamespace.c_str())) + "u, // " + componentData->m_nameWithNamespace + "\n";
+                schemas += "        " + std::to_string(GetSchemaHash(componentData->m_nameWithNamespace)) + "u,\n";
+            }
+
+            contents += "\n    // Indexed by ReflectedComponentID<T>::value.\n";
+            contents += "    constexpr uint32_t g_reflectedComponentTypeHashes[REFLECTED_COMPONENT_COUNT] = {\n" + typeHashes + "    };\n\n";
+            contents += "    constexpr uint32_t g_reflectedComponentSchemas[REFLECTED_COMPONENT_COUNT] = {\n" + schemas + "    };\n\n";
+            contents += "    // ID of the component a section was written for, -1 if the component is unknown or its schema has changed since.\n";
+            contents += "    inline int32_t FindSectionComponent(const ReflectedSection& section)\n";
+            contents += "    {\n";
+            contents += "        for (uint32_t i = 0; i < REFLECTED_COMPONENT_COUNT; i++)\n";
+            contents += "        {\n";
+            contents += "            if (g_reflectedComponentTypeHashes[i] == section.m_typeHash && section.m_typeHash != 0)\n";
+            contents += "                return g_reflectedComponentSchemas[i] == section.m_schemaHash ? static_cast<int32_t>(i) : -1;\n";
+            contents += "        }\n\n";
+            contents += "        return -1;\n";
+            contents += "    }\n";
+            contents += "\n    // Defined by the registry, indexed by ReflectedComponentID<T>::value.\n";
+            contents += "    extern const ReflectedComponentFunctions g_reflectedComponentFunctions[REFLECTED_COMPONENT_COUNT];\n\n";
+            contents += "    // Deserializes the next section into the component it was written for, looked up by its type hash. Sections of\n";
+            contents += "    // unknown components & outdated schemas are skipped, the result tells which happened.\n";
+            contents += "    inline ReflectedSectionResult LoadReflectedSection(std::istream& stream, entt::snapshot_loader& loader, cereal::PortableBinaryInputArchive& archive)\n";
+            contents += "    {\n";
+            contents += "        const ReflectedSection section = PeekSection(stream, archive);\n\n";
+            contents += "        for (uint32_t i = 0; i < REFLECTED_COMPONENT_COUNT; i++)\n";
+            contents += "        {\n";
+            contents += "            if (g_reflectedComponentTypeHashes[i] == section.m_typeHash && section.m_typeHash != 0)\n";
+            contents += "                return g_reflectedComponentFunctions[i].m_deserializeSection(stream, loader, archive);\n";
+            contents += "        }\n\n";
+            contents += "        SkipSection(stream, archive);\n";
+            contents += "        return ReflectedSectionResult::Unknown;\n";
+            contents += "    }\n\n";
+            if (!pooledClasses.empty())
+            {
+                contents += "    // Defined by the registry.\n";
+                contents += "    extern const ReflectedPooledClass g_reflectedPooledClasses[REFLECTED_POOLED_CLASS_COUNT];\n\n";
+            }
+
+            contents += "    // Fills stats, indexed by ReflectedComponentID<T>::value, & returns the bytes of all pools including their estimated owned heap.\n";
+            contents += "    // Pools of g_reflectedPooledClasses are counted in the total & written to classStats, if given, in the same order.\n";
+            contents += "    inline size_t SampleReflectedMemoryStats(ReflectedMemoryStats (&stats)[REFLECTED_COMPONENT_COUNT], ReflectedMemoryStats*" + std::string(pooledClasses.empty() ? "" : " classStats") + " = nullptr)\n";
+            contents += "    {\n";
+            contents += "        size_t total = 0;\n\n";
+            contents += "        for (uint32_t i = 0; i < REFLECTED_COMPONENT_COUNT; i++)\n";
+            contents += "        {\n";
+            contents += "            stats[i] = g_reflectedComponentFunctions[i].m_memoryStats ? g_reflectedComponentFunctions[i].m_memoryStats() : ReflectedMemoryStats();\n";
+            contents += "            total += stats[i].m_storageBytes + stats[i].m_ownedHeapBytes;\n";
+            contents += "        }\n\n";
+
+            if (!pooledClasses.empty())
+            {
+                contents += "        for (uint32_t i = 0; i < REFLECTED_POOLED_CLASS_COUNT; i++)\n";
+                contents += "        {\n";
+                contents += "            const ReflectedMemoryStats pool = g_reflectedPooledClasses[i].m_memoryStats();\n";
+                contents += "            total += pool.m_storageBytes + pool.m_ownedHeapBytes;\n\n";
+                contents += "            if (classStats != nullptr)\n";
+                contents += "                classStats[i] = pool;\n";
+                contents += "        }\n\n";
+            }
+
+            contents += "        return total;\n";
+            contents += "    }\n";
+        }
+
+        contents += "} // namespace Lina::" + space + "\n";
+        WriteIfChanged(contents, module.m_headerPath);
+    }
+
+    void HeaderTool::WriteIfChanged(const std::string& contents, const std::string& path)
+    {
+        const std::string tempPath = path + ".tmp";
+        std::ofstream     file;
+        file.open(tempPath, std::ofstream::out | std::ofstream::trunc | std::ofstream::binary);
+
+        if (!file.is_open())
+        {
+            std::cerr << "Lina Header Tool: could not open " << tempPath << " for writing." << std::endl;
+            return;
+        }
+
+        file << contents;
+        file.close();
+        ReplaceIfChanged(tempPath, path);
+    }
+
+    void HeaderTool::SerializePCH(const LinaModule& module)
+    {
+        std::string contents;
+        contents += "// Precompiled header of the reflection registry, generated by Lina Header Tool, do not modify.\n";
+        contents += "#pragma once\n\n";
+        contents += "#include <entt/meta/factory.hpp>\n";
+        contents += "#include <entt/meta/meta.hpp>\n";
+        contents += "#include <entt/meta/node.hpp>\n";
+        contents += "#include <entt/meta/resolve.hpp>\n\n";
+
+        for (auto& include : GetModuleIncludes(module))
+            contents += "#include \"" + include + "\"\n";
+
+        // Leave an unchanged header untouched, rewriting it would invalidate the precompiled header.
+        WriteIfChanged(contents, module.m_pchPath);
+    }
+
+    void HeaderTool::SerializeLayoutReport(const LinaModule& module)
+    {
+        const std::vector<LinaComponent*> components = GetModuleComponents(module);
+
+        std::string contents;
+        contents += "// Layout report of the reflected components, generated by Lina Header Tool, do not modify.\n";
+        contents += "// Budgets are checked at compile time, running the program prints sizes, offsets & padding.\n";
+
+        std::set<std::string> includes;
+        for (auto* componentData : components)
+            includes.insert(componentData->m_hppInclude);
+
+        for (auto& include : includes)
+            contents += "#include \"" + include + "\"\n";
+
+        contents += R"(#include <algorithm>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <type_traits>
+#include <vector>
+
+namespace Lina
+{
+    namespace
+    {
+        struct LayoutField
+        {
+            const char* m_name      = nullptr;
+            size_t      m_offset    = 0;
+            size_t      m_size      = 0;
+            size_t      m_alignment = 0;
+        };
+
+        struct LayoutType
+        {
+            const char*              m_name      = nullptr;
+            size_t                   m_size      = 0;
+            size_t                   m_alignment = 0;
+            size_t                   m_budget    = 0;
+            std::vector<LayoutField> m_fields;
+            size_t                   m_gaps      = 0;
+            size_t                   m_packed    = 0;
+        };
+
+        // offsetof is not usable on polymorphic types, offsets are taken from a default constructed prototype instead.
+        template <typename Type, typename Member, typename Owner>
+        LayoutField Field(const Type& prototype, const char* name, Member Owner::*member)
+        {
+            LayoutField field;
+            field.m_name      = name;
+            field.m_offset    = static_cast<size_t>(reinterpret_cast<const char*>(&(prototype.*member)) - reinterpret_cast<const char*>(&prototype));
+            field.m_size      = sizeof(Member);
+            field.m_alignment = alignof(Member);
+            return field;
+        }
+
+        template <typename Type>
+        LayoutType Layout(const char* name, size_t budget, std::vector<LayoutField> fields)
+        {
+            LayoutType type;
+            type.m_name      = name;
+            type.m_size      = sizeof(Type);
+            type.m_alignment = alignof(Type);
+            type.m_budget    = budget;
+            type.m_fields    = fields;
+            std::sort(type.m_fields.begin(), type.m_fields.end(), [](const LayoutField& a, const LayoutField& b) { return a.m_offset < b.m_offset; });
+
+            // Bytes between & after the reflected fields. Only reflected members are known, so this is unreflected members + padding.
+            size_t end = type.m_fields.empty() ? 0 : type.m_fields.front().m_offset;
+            for (auto& field : type.m_fields)
+            {
+                type.m_gaps += field.m_offset > end ? field.m_offset - end : 0;
+                end = std::max(end, field.m_offset + field.m_size);
+            }
+            type.m_gaps += type.m_size > end ? type.m_size - end : 0;
+
+            // Size of only the reflected fields ordered by decreasing alignment, everything in front of the first field kept as is.
+            // Unreflected members after the first field are not counted, so the difference to m_size is unreflected + padding.
+            std::vector<LayoutField> packed = type.m_fields;
+            std::stable_sort(packed.begin(), packed.end(), [](const LayoutField& a, const LayoutField& b) { return a.m_alignment > b.m_alignment; });
+
+            size_t packedSize = type.m_fields.empty() ? type.m_size : type.m_fields.front().m_offset;
+            for (auto& field : packed)
+                packedSize = (packedSize + field.m_alignment - 1) / field.m_alignment * field.m_alignment + field.m_size;
+            type.m_packed = std::min(type.m_size, (packedSize + type.m_alignment - 1) / type.m_alignment * type.m_alignment);
+            return type;
+        }
+)";
+
+        for (auto* componentData : components)
+        {
+            const std::string& className = componentData->m_nameWithNamespace;
+            auto               budget    = module.m_layoutBudgets.find(className);
+            const std::string  limit     = budget == module.m_layoutBudgets.end() ? "0" : std::to_string(budget->second);
+
+            contents += "\n        static_assert(std::is_default_constructible_v<" + className + ">, \"" + className + " needs to be default constructible.\");\n";
+
+            if (budget != module.m_layoutBudgets.end())
+                contents += "        static_assert(sizeof(" + className + ") <= " + limit + ", \"" + className + " exceeds its layout budget of " + limit + " bytes.\");\n";
+
+            contents += "\n        LayoutType Layout_" + GetFunctionName(className) + "()\n";
+            contents += "        {\n";
+            contents += "            static const " + className + " prototype{};\n";
+            contents += "            return Layout<" + className + ">(\"" + className + "\", " + limit + ", {\n";
+            contents += "                Field(prototype, \"m_isEnabled\", &" + className + "::m_isEnabled),\n";
+
+            for (auto& property : GetFlatProperties(className))
+                contents += "                Field(prototype, \"" + property.m_propertyName + "\", &" + className + "::" + property.m_propertyName + "),\n";
+
+            contents += "            });\n";
+            contents += "        }\n";
+        }
+
+        contents += "    } // namespace\n} // namespace Lina\n\n";
+        contents += "int main(int argc, char** argv)\n{\n";
+        contents += "    // --instances N scales the unreflected + padding bytes, e.g. to the expected number of components in a level.\n";
+        contents += "    const unsigned long long instances = argc > 2 && std::strcmp(argv[1], \"--instances\") == 0 ? std::strtoull(argv[2], nullptr, 10) : 1;\n";
+        contents += "    std::vector<Lina::LayoutType> types;\n";
+
+        for (auto* componentData : components)
+            contents += "    types.push_back(Lina::Layout_" + GetFunctionName(componentData->m_nameWithNamespace) + "());\n";
+
+        contents += R"(
+    for (auto& type : types)
+    {
+        std::printf("%s: size %zu, align %zu, unreflected + padding %zu, reflected packed %zu", type.m_name, type.m_size, type.m_alignment, type.m_gaps, type.m_packed);
+        if (type.m_budget != 0)
+            std::printf(", budget %zu", type.m_budget);
+        std::printf("\n");
+
+        for (auto& field : type.m_fields)
+            std::printf("    %-32s offset %4zu  size %4zu  align %2zu\n", field.m_name, field.m_offset, field.m_size, field.m_alignment);
+    }
+
+    // Ranked by the bytes beyond the packed reflected fields. Without every member reflected this is unreflected + padding, not padding alone.
+    std::stable_sort(types.begin(), types.end(), [](const Lina::LayoutType& a, const Lina::LayoutType& b) { return a.m_size - a.m_packed > b.m_size - b.m_packed; });
+    std::printf("\nUnreflected + padding bytes per instance (x %llu instances):\n", instances);
+
+    for (auto& type : types)
+        std::printf("    %-40s %4zu  %12llu\n", type.m_name, type.m_size - type.m_packed, static_cast<unsigned long long>(type.m_size - type.m_packed) * instances);
+
+    return 0;
+}
+)";
+
+        WriteIfChanged(contents, module.m_layoutPath);
+    }
+
+    void HeaderTool::BenchmarkIO()
+    {
+        ScanRoots();
+
+        std::vector<std::string> paths;
+        for (auto& headerFile : m_headerFiles)
+            paths.push_back(headerFile.m_path);
+
+        std::cout << "Lina Header Tool: reading " << paths.size() << " headers, " << m_ioBenchmarkRuns << " run(s) per case." << std::endl;
+        std::cout << "backend    cache   files     MB   best ms   mean ms   MB/s (best)" << std::endl;
+
+        for (FileReaderBackend backend : {FileReaderBackend::Blocking, FileReaderBackend::Uring})
+        {
+            std::unique_ptr<FileReader> reader = FileReader::Create(backend);
+
+            if (reader->GetBackend() != backend)
+            {
+                std::cout << FileReader::GetBackendName(backend) << " backend is not available on this system." << std::endl;
+                continue;
+            }
+
+            for (bool cold : {true, false})
+            {
+                double   bestMs  = 0.0;
+                double   totalMs = 0.0;
+                uint64_t bytes   = 0;
+                size_t   files   = 0;
+                bool     skipped = false;
+
+                for (int run = 0; run < m_ioBenchmarkRuns && !skipped; run++)
+                {
+                    if (cold)
+                    {
+                        for (auto& path : paths)
+                            skipped |= !FileReader::EvictFromPageCache(path);
+                    }
+
+                    bytes = 0;
+                    files = 0;
+
+                    const auto start = std::chrono::steady_clock::now();
+                    reader->ReadFiles(paths, [&](size_t, std::string& content) {
+                        bytes += content.size();
+                        files++;
+                    });
+                    const double ms = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+
+                    bestMs = run == 0 ? ms : std::min(bestMs, ms);
+                    totalMs += ms;
+                }
+
+                if (skipped)
+                {
+                    std::cout << FileReader::GetBackendName(backend) << " cold: evicting the page cache is not supported here." << std::endl;
+                    continue;
+                }
+
+                const double megaBytes = bytes / (1024.0 * 1024.0);
+                char         row[128];
+                std::snprintf(row, sizeof(row), "%-10s %-7s %5zu %6.2f %9.3f %9.3f %10.1f", FileReader::GetBackendName(backend), cold ? "cold" : "warm", files, megaBytes, bestMs, totalMs / m_ioBenchmarkRuns,
+                              bestMs > 0.0 ? megaBytes / (bestMs / 1000.0) : 0.0);
+                std::cout << row << std::endl;
+            }
+        }
     }
 
 } // namespace Lina
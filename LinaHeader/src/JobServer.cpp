@@ -0,0 +1,260 @@
+/*
+This file is a part of: Lina Engine
+https://github.com/inanevin/LinaEngine
+
+Author: Inan Evin
+http://www.inanevin.com
+
+Copyright (c) [2018-2020] [Inan Evin]
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+#include "JobServer.hpp"
+#include <cstdlib>
+#include <iostream>
+
+#ifdef _WIN32
+#define WIN32_LEAN_AND_MEAN
+#define NOMINMAX
+#include <windows.h>
+#else
+#include <cerrno>
+#include <fcntl.h>
+#include <poll.h>
+#include <unistd.h>
+#endif
+
+namespace Lina
+{
+
+#define TOKEN_WAIT_MS 10
+
+    JobServer::~JobServer()
+    {
+#ifdef _WIN32
+        if (m_semaphore != nullptr)
+            CloseHandle(m_semaphore);
+#else
+        if (m_readFd >= 0)
+            close(m_readFd);
+
+        if (m_writeFd >= 0)
+            close(m_writeFd);
+#endif
+    }
+
+    JobServerState JobServer::Connect()
+    {
+        if (m_state != JobServerState::Unchecked)
+            return m_state;
+
+        m_state               = JobServerState::None;
+        const char* makeFlags = std::getenv("MAKEFLAGS");
+
+        if (makeFlags == nullptr)
+            return m_state;
+
+        // Recursive makes may append their own flags, the last jobserver option is the one meant for us.
+        const std::string flags = makeFlags;
+        std::string       auth  = "";
+
+        for (const char* option : {"--jobserver-auth=", "--jobserver-fds="})
+        {
+            const size_t pos = flags.rfind(option);
+            if (pos == std::string::npos)
+                continue;
+
+            const size_t start = pos + std::char_traits<char>::length(option);
+            auth               = flags.substr(start, flags.find(' ', start) - start);
+            break;
+        }
+
+        if (auth.empty())
+            return m_state;
+
+        if (ConnectAuth(auth))
+            m_state = JobServerState::Connected;
+        else
+        {
+            // The build still counts this process as a job, so it runs on the implicit token alone.
+            m_state = JobServerState::Unusable;
+            std::cerr << "Lina Header Tool: could not use the jobserver " << auth << ", parsing on a single worker instead of --jobs." << std::endl;
+        }
+
+        return m_state;
+    }
+
+#ifdef _WIN32
+    bool JobServer::ConnectAuth(const std::string& auth)
+    {
+        m_semaphore = OpenSemaphoreA(SEMAPHORE_ALL_ACCESS, FALSE, auth.c_str());
+        return m_semaphore != nullptr;
+    }
+
+    bool JobServer::Acquire(int timeoutMs, char& token)
+    {
+        token = '+';
+
+        if (m_state != JobServerState::Connected)
+            return m_state == JobServerState::None;
+
+        return WaitForSingleObject(m_semaphore, static_cast<DWORD>(timeoutMs)) == WAIT_OBJECT_0;
+    }
+
+    void JobServer::Release(char token)
+    {
+        if (m_state == JobServerState::Connected)
+            ReleaseSemaphore(m_semaphore, 1, nullptr);
+    }
+#else
+    bool JobServer::ConnectAuth(const std::string& auth)
+    {
+        if (auth.rfind("fifo:", 0) == 0)
+        {
+            const std::string path = auth.substr(5);
+            m_readFd               = open(path.c_str(), O_RDONLY | O_NONBLOCK | O_CLOEXEC);
+            m_writeFd              = m_readFd < 0 ? -1 : open(path.c_str(), O_WRONLY | O_CLOEXEC);
+            return m_readFd >= 0 && m_writeFd >= 0;
+        }
+
+        const size_t comma = auth.find(',');
+        if (comma == std::string::npos)
+            return false;
+
+        const int readFd  = std::atoi(auth.c_str());
+        const int writeFd = std::atoi(auth.c_str() + comma + 1);
+
+        // Make closes the descriptors for commands it does not consider recursive ('+' prefix or $(MAKE)).
+        if (readFd < 0 || writeFd < 0 || fcntl(readFd, F_GETFD) == -1 || fcntl(writeFd, F_GETFD) == -1)
+            return false;
+
+        // The pipe is shared with the rest of the build, making it non-blocking would affect every other
+        // client. Reopening it through /proc gives a description of our own which can be non-blocking,
+        // so a token taken by another job between poll & read doesn't block the worker.
+        m_readFd  = open(("/proc/self/fd/" + std::to_string(readFd)).c_str(), O_RDONLY | O_NONBLOCK | O_CLOEXEC);
+        m_writeFd = m_readFd < 0 ? -1 : fcntl(writeFd, F_DUPFD_CLOEXEC, 0);
+        return m_readFd >= 0 && m_writeFd >= 0;
+    }
+
+    bool JobServer::Acquire(int timeoutMs, char& token)
+    {
+        if (m_state != JobServerState::Connected)
+            return m_state == JobServerState::None;
+
+        pollfd request;
+        request.fd      = m_readFd;
+        request.events  = POLLIN;
+        request.revents = 0;
+
+        if (poll(&request, 1, timeoutMs) <= 0)
+            return false;
+
+        return read(m_readFd, &token, 1) == 1;
+    }
+
+    void JobServer::Release(char token)
+    {
+        if (m_state != JobServerState::Connected)
+            return;
+
+        // Make checks the tokens it gets back, so the same byte is written back.
+        while (write(m_writeFd, &token, 1) == -1 && errno == EINTR)
+            ;
+    }
+#endif
+
+    WorkerPool::WorkerPool(JobServer& jobServer, unsigned int threadCount, const Job& job) : m_jobServer(jobServer), m_job(job)
+    {
+        for (unsigned int i = 0; i < threadCount; i++)
+            m_threads.emplace_back(&WorkerPool::Work, this, i == 0);
+    }
+
+    WorkerPool::~WorkerPool()
+    {
+        Finish();
+    }
+
+    void WorkerPool::Push(size_t index)
+    {
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            m_queue.push_back(index);
+        }
+
+        m_condition.notify_one();
+    }
+
+    void WorkerPool::Finish()
+    {
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            m_finished = true;
+        }
+
+        m_condition.notify_all();
+
+        for (auto& thread : m_threads)
+            thread.join();
+
+        m_threads.clear();
+    }
+
+    void WorkerPool::Work(bool implicitToken)
+    {
+        bool                         hasToken = implicitToken;
+        char                         token    = 0;
+        std::unique_lock<std::mutex> lock(m_mutex);
+
+        while (true)
+        {
+            m_condition.wait(lock, [this]() { return !m_queue.empty() || m_finished; });
+
+            if (m_queue.empty())
+                break;
+
+            // Additional workers only join in while the build hands out tokens, waiting without the lock
+            // & checking the queue again, it may have been drained in the meantime.
+            if (!hasToken)
+            {
+                lock.unlock();
+                hasToken = m_jobServer.Acquire(TOKEN_WAIT_MS, token);
+                lock.lock();
+                continue;
+            }
+
+            const size_t index = m_queue.front();
+            m_queue.pop_front();
+
+            lock.unlock();
+            m_job(index);
+            lock.lock();
+
+            // Nothing queued, give the token back so other jobs of the build can run meanwhile.
+            if (!implicitToken && m_queue.empty())
+            {
+                m_jobServer.Release(token);
+                hasToken = false;
+            }
+        }
+
+        if (hasToken && !implicitToken)
+            m_jobServer.Release(token);
+    }
+} // namespace Lina
@@ -0,0 +1,471 @@
+/*
+This file is a part of: Lina Engine
+https://github.com/inanevin/LinaEngine
+
+Author: Inan Evin
+http://www.inanevin.com
+
+Copyright (c) [2018-2020] [Inan Evin]
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+#include "ParseCache.hpp"
+#include <algorithm>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <random>
+
+namespace Lina
+{
+
+#define CACHE_ENTRY_MAGIC     0x4350484C // LHPC
+#define CACHE_ENTRY_EXTENSION ".lhc"
+#define CACHE_TRIM_RATIO      0.9
+
+// Smallest encoding of each record, a count or size being 4 bytes.
+#define CACHE_STRING_MIN_SIZE    4
+#define CACHE_PROPERTY_MIN_SIZE  (7 * CACHE_STRING_MIN_SIZE)
+#define CACHE_COMPONENT_MIN_SIZE (5 * CACHE_STRING_MIN_SIZE + 12)
+#define CACHE_CLASS_MIN_SIZE     (3 * CACHE_STRING_MIN_SIZE + 8)
+
+    namespace
+    {
+        struct CacheEntryHeader
+        {
+            uint32_t m_magic       = CACHE_ENTRY_MAGIC;
+            uint32_t m_version     = LINA_HEADER_TOOL_VERSION;
+            uint64_t m_check       = 0;
+            uint64_t m_contentSize = 0;
+            uint64_t m_payloadSize = 0;
+        };
+
+        // Second, independent hash of the content stored inside the entry, guards against key collisions.
+        uint64_t GetCheck(const std::string& content)
+        {
+            uint64_t hash = 14695981039346656037ull;
+            for (unsigned char c : content)
+                hash = (hash ^ c) * 1099511628211ull;
+            return hash;
+        }
+
+        void WriteString(std::string& out, const std::string& str)
+        {
+            const uint32_t size = static_cast<uint32_t>(str.size());
+            out.append(reinterpret_cast<const char*>(&size), sizeof(uint32_t));
+            out.append(str);
+        }
+
+        void WriteStrings(std::string& out, const std::vector<std::string>& strings)
+        {
+            const uint32_t count = static_cast<uint32_t>(strings.size());
+            out.append(reinterpret_cast<const char*>(&count), sizeof(uint32_t));
+
+            for (auto& str : strings)
+                WriteString(out, str);
+        }
+
+        void WriteProperties(std::string& out, const std::vector<LinaProperty>& properties)
+        {
+            const uint32_t count = static_cast<uint32_t>(properties.size());
+            out.append(reinterpret_cast<const char*>(&count), sizeof(uint32_t));
+
+            for (auto& property : properties)
+            {
+                WriteString(out, property.m_title);
+                WriteString(out, property.m_type);
+                WriteString(out, property.m_tooltip);
+                WriteString(out, property.m_dependsOn);
+                WriteString(out, property.m_propertyName);
+                WriteString(out, property.m_memberType);
+                WriteString(out, property.m_range);
+            }
+        }
+
+        class PayloadReader
+        {
+        public:
+            PayloadReader(const std::string& data) : m_data(data){};
+
+            bool ReadCount(uint32_t& count)
+            {
+                if (m_data.size() - m_position < sizeof(uint32_t))
+                    return false;
+
+                std::memcpy(&count, m_data.data() + m_position, sizeof(uint32_t));
+                m_position += sizeof(uint32_t);
+                return true;
+            }
+
+            // Reads the count of the records that follow & checks that they can fit in the rest of the payload,
+            // so that a corrupt count can not make the caller allocate more than the entry holds.
+            bool ReadCount(uint32_t& count, size_t minRecordSize)
+            {
+                return ReadCount(count) && uint64_t(count) * minRecordSize <= m_data.size() - m_position;
+            }
+
+            bool ReadString(std::string& str)
+            {
+                uint32_t size = 0;
+                if (!ReadCount(size) || m_data.size() - m_position < size)
+                    return false;
+
+                str.assign(m_data, m_position, size);
+                m_position += size;
+                return true;
+            }
+
+            bool ReadStrings(std::vector<std::string>& strings)
+            {
+                uint32_t count = 0;
+                if (!ReadCount(count, CACHE_STRING_MIN_SIZE))
+                    return false;
+
+                strings.resize(count);
+                for (auto& str : strings)
+                {
+                    if (!ReadString(str))
+                        return false;
+                }
+
+                return true;
+            }
+
+            bool ReadProperties(std::vector<LinaProperty>& properties)
+            {
+                uint32_t count = 0;
+                if (!ReadCount(count, CACHE_PROPERTY_MIN_SIZE))
+                    return false;
+
+                properties.resize(count);
+                for (auto& property : properties)
+                {
+                    if (!ReadString(property.m_title) || !ReadString(property.m_type) || !ReadString(property.m_tooltip) || !ReadString(property.m_dependsOn) || !ReadString(property.m_propertyName) ||
+                        !ReadString(property.m_memberType) || !ReadString(property.m_range))
+                        return false;
+                }
+
+                return true;
+            }
+
+            bool IsAtEnd() const
+            {
+                return m_position == m_data.size();
+            }
+
+        private:
+            const std::string& m_data;
+            size_t             m_position = 0;
+        };
+
+        bool IsHex(const std::string& str, size_t length)
+        {
+            return str.size() == length && str.find_first_not_of("0123456789abcdef") == std::string::npos;
+        }
+
+        // Entries are named xx/yyyyyyyyyyyyyy.lhc after their key. Anything else, including the temporary files
+        // other processes are still writing, is not ours to count or remove.
+        bool IsEntryPath(const std::filesystem::path& path)
+        {
+            return path.extension() == CACHE_ENTRY_EXTENSION && IsHex(path.stem().string(), 14) && IsHex(path.parent_path().filename().string(), 2);
+        }
+    } // namespace
+
+    void ParseCache::Open(const std::string& directory, uint64_t maxSize)
+    {
+        m_directory = directory;
+        m_maxSize   = maxSize;
+        m_nonce     = (uint64_t(std::random_device()()) << 32) | std::random_device()();
+    }
+
+    uint64_t ParseCache::GetKey(const std::string& content)
+    {
+        // MurmurHash64A, seeded with the tool version.
+        const uint64_t m    = 0xc6a4a7935bd1e995ull;
+        const int      r    = 47;
+        const size_t   len  = content.size();
+        uint64_t       hash = LINA_HEADER_TOOL_VERSION ^ (len * m);
+
+        const char* data   = content.data();
+        const char* blocks = data + (len / 8) * 8;
+
+        for (const char* p = data; p != blocks; p += 8)
+        {
+            uint64_t k;
+            std::memcpy(&k, p, sizeof(uint64_t));
+            k *= m;
+            k ^= k >> r;
+            k *= m;
+            hash ^= k;
+            hash *= m;
+        }
+
+        switch (len & 7)
+        {
+        case 7:
+            hash ^= uint64_t(static_cast<unsigned char>(blocks[6])) << 48;
+            [[fallthrough]];
+        case 6:
+            hash ^= uint64_t(static_cast<unsigned char>(blocks[5])) << 40;
+            [[fallthrough]];
+        case 5:
+            hash ^= uint64_t(static_cast<unsigned char>(blocks[4])) << 32;
+            [[fallthrough]];
+        case 4:
+            hash ^= uint64_t(static_cast<unsigned char>(blocks[3])) << 24;
+            [[fallthrough]];
+        case 3:
+            hash ^= uint64_t(static_cast<unsigned char>(blocks[2])) << 16;
+            [[fallthrough]];
+        case 2:
+            hash ^= uint64_t(static_cast<unsigned char>(blocks[1])) << 8;
+            [[fallthrough]];
+        case 1:
+            hash ^= uint64_t(static_cast<unsigned char>(blocks[0]));
+            hash *= m;
+        };
+
+        hash ^= hash >> r;
+        hash *= m;
+        hash ^= hash >> r;
+        return hash;
+    }
+
+    std::string ParseCache::GetDefaultDirectory()
+    {
+        if (const char* xdg = std::getenv("XDG_CACHE_HOME"); xdg != nullptr && xdg[0] != '\0')
+            return std::string(xdg) + "/lina-header";
+
+        if (const char* localAppData = std::getenv("LOCALAPPDATA"); localAppData != nullptr && localAppData[0] != '\0')
+            return std::string(localAppData) + "/lina-header";
+
+        if (const char* home = std::getenv("HOME"); home != nullptr && home[0] != '\0')
+            return std::string(home) + "/.cache/lina-header";
+
+        return "";
+    }
+
+    std::string ParseCache::GetEntryPath(uint64_t key)
+    {
+        char hex[17];
+        std::snprintf(hex, sizeof(hex), "%016llx", static_cast<unsigned long long>(key));
+        return m_directory + "/" + std::string(hex, 2) + "/" + std::string(hex + 2) + CACHE_ENTRY_EXTENSION;
+    }
+
+    bool ParseCache::Load(uint64_t key, const std::string& content, LinaHeaderData& data)
+    {
+        const std::string path = GetEntryPath(key);
+        std::ifstream     file;
+        file.open(path, std::ifstream::in | std::ifstream::binary);
+
+        if (!file.is_open())
+            return false;
+
+        CacheEntryHeader header;
+        file.read(reinterpret_cast<char*>(&header), sizeof(CacheEntryHeader));
+
+        if (!file.good() || header.m_magic != CACHE_ENTRY_MAGIC || header.m_version != LINA_HEADER_TOOL_VERSION || header.m_contentSize != content.size() || header.m_check != GetCheck(content))
+            return false;
+
+        // The payload fills the rest of the entry, checked before allocating for it.
+        std::error_code err;
+        const uintmax_t fileSize = std::filesystem::file_size(path, err);
+
+        if (err || fileSize < sizeof(CacheEntryHeader) || header.m_payloadSize != fileSize - sizeof(CacheEntryHeader))
+            return false;
+
+        std::string payload;
+        payload.resize(static_cast<size_t>(header.m_payloadSize));
+        file.read(&payload[0], payload.size());
+
+        if (!file.good())
+            return false;
+
+        file.close();
+
+        LinaHeaderData result;
+        PayloadReader  reader(payload);
+        uint32_t       count = 0;
+
+        if (!reader.ReadCount(count, CACHE_COMPONENT_MIN_SIZE))
+            return false;
+
+        result.m_components.resize(count);
+        for (auto& component : result.m_components)
+        {
+            uint32_t flags = 0;
+            if (!reader.ReadString(component.m_name) || !reader.ReadString(component.m_nameWithNamespace) || !reader.ReadString(component.m_title) || !reader.ReadString(component.m_icon) ||
+                !reader.ReadString(component.m_category) || !reader.ReadCount(flags) || !reader.ReadStrings(component.m_bases) || !reader.ReadProperties(component.m_properties))
+                return false;
+
+            component.m_canAddComponent      = (flags & 1) != 0;
+            component.m_listenToValueChanged = (flags & 2) != 0;
+            component.m_isStruct             = (flags & 4) != 0;
+        }
+
+        if (!reader.ReadCount(count, CACHE_CLASS_MIN_SIZE))
+            return false;
+
+        result.m_classes.resize(count);
+        for (auto& linaClass : result.m_classes)
+        {
+            if (!reader.ReadString(linaClass.m_name) || !reader.ReadString(linaClass.m_nameWithNamespace) || !reader.ReadString(linaClass.m_title) || !reader.ReadStrings(linaClass.m_bases) || !reader.ReadProperties(linaClass.m_properties))
+                return false;
+        }
+
+        if (!reader.IsAtEnd())
+            return false;
+
+        // Refresh the entry so that it counts as recently used when trimming.
+        std::filesystem::last_write_time(path, std::filesystem::file_time_type::clock::now(), err);
+
+        data = std::move(result);
+        return true;
+    }
+
+    void ParseCache::Store(uint64_t key, const std::string& content, const LinaHeaderData& data)
+    {
+        std::string payload;
+        uint32_t    count = static_cast<uint32_t>(data.m_components.size());
+        payload.append(reinterpret_cast<const char*>(&count), sizeof(uint32_t));
+
+        for (auto& component : data.m_components)
+        {
+            WriteString(payload, component.m_name);
+            WriteString(payload, component.m_nameWithNamespace);
+            WriteString(payload, component.m_title);
+            WriteString(payload, component.m_icon);
+            WriteString(payload, component.m_category);
+            const uint32_t flags = (component.m_canAddComponent ? 1 : 0) | (component.m_listenToValueChanged ? 2 : 0) | (component.m_isStruct ? 4 : 0);
+            payload.append(reinterpret_cast<const char*>(&flags), sizeof(uint32_t));
+            WriteStrings(payload, component.m_bases);
+            WriteProperties(payload, component.m_properties);
+        }
+
+        count = static_cast<uint32_t>(data.m_classes.size());
+        payload.append(reinterpret_cast<const char*>(&count), sizeof(uint32_t));
+
+        for (auto& linaClass : data.m_classes)
+        {
+            WriteString(payload, linaClass.m_name);
+            WriteString(payload, linaClass.m_nameWithNamespace);
+            WriteString(payload, linaClass.m_title);
+            WriteStrings(payload, linaClass.m_bases);
+            WriteProperties(payload, linaClass.m_properties);
+        }
+
+        CacheEntryHeader header;
+        header.m_check       = GetCheck(content);
+        header.m_contentSize = content.size();
+        header.m_payloadSize = payload.size();
+
+        const std::string path = GetEntryPath(key);
+        std::error_code   err;
+        std::filesystem::create_directories(std::filesystem::path(path).parent_path(), err);
+
+        // Write under a name unique to this process, then move it into place in one step.
+        char tempSuffix[40];
+        std::snprintf(tempSuffix, sizeof(tempSuffix), ".%016llx.%u.tmp", static_cast<unsigned long long>(m_nonce), m_tempCounter++);
+        const std::string tempPath = path + tempSuffix;
+
+        std::ofstream file;
+        file.open(tempPath, std::ofstream::out | std::ofstream::trunc | std::ofstream::binary);
+
+        if (!file.is_open())
+            return;
+
+        file.write(reinterpret_cast<const char*>(&header), sizeof(CacheEntryHeader));
+        file.write(payload.data(), payload.size());
+        file.close();
+
+        if (!file.good())
+        {
+            std::filesystem::remove(tempPath, err);
+            return;
+        }
+
+        std::filesystem::rename(tempPath, path, err);
+
+        if (err)
+            std::filesystem::remove(tempPath, err);
+        else
+            m_storedEntries = true;
+    }
+
+    void ParseCache::Trim()
+    {
+        // Only a run that added entries can have grown the store.
+        if (!m_storedEntries || m_maxSize == 0)
+            return;
+
+        struct Entry
+        {
+            std::filesystem::path           m_path;
+            std::filesystem::file_time_type m_time;
+            uint64_t                        m_size = 0;
+        };
+
+        std::vector<Entry> entries;
+        uint64_t           totalSize = 0;
+        std::error_code    err;
+
+        for (auto it = std::filesystem::recursive_directory_iterator(m_directory, err); !err && it != std::filesystem::recursive_directory_iterator(); it.increment(err))
+        {
+            std::error_code entryErr;
+
+            // Entries live one level down, deeper folders can't contain any.
+            if (it.depth() >= 1)
+                it.disable_recursion_pending();
+
+            if (it.depth() != 1 || !it->is_regular_file(entryErr) || !IsEntryPath(it->path()))
+                continue;
+
+            Entry entry;
+            entry.m_path = it->path();
+            entry.m_size = it->file_size(entryErr);
+            entry.m_time = it->last_write_time(entryErr);
+
+            if (entryErr)
+                continue;
+
+            totalSize += entry.m_size;
+            entries.push_back(entry);
+        }
+
+        if (totalSize <= m_maxSize)
+            return;
+
+        // Least recently used first, Load refreshes the modification time of every hit. Entries removed
+        // concurrently by another process are simply skipped.
+        std::sort(entries.begin(), entries.end(), [](const Entry& a, const Entry& b) { return a.m_time < b.m_time; });
+
+        const uint64_t targetSize = static_cast<uint64_t>(m_maxSize * CACHE_TRIM_RATIO);
+        for (auto& entry : entries)
+        {
+            if (totalSize <= targetSize)
+                break;
+
+            std::filesystem::remove(entry.m_path, err);
+            totalSize -= entry.m_size;
+        }
+    }
+} // namespace Lina
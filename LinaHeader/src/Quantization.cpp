@@ -0,0 +1,93 @@
+/*
+This file is a part of: Lina Engine
+https://github.com/inanevin/LinaEngine
+
+Author: Inan Evin
+http://www.inanevin.com
+
+Copyright (c) [2018-2020] [Inan Evin]
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+#include "Quantization.hpp"
+#include <cmath>
+#include <cstdlib>
+
+namespace Lina
+{
+    bool ParseQuantizationRange(const std::string& range, double& min, double& max, double& precision, std::string& error)
+    {
+        double* values[3] = {&min, &max, &precision};
+        size_t  start     = 0;
+
+        for (size_t i = 0; i < 3; i++)
+        {
+            const size_t end = i < 2 ? range.find(',', start) : range.size();
+
+            if (end == std::string::npos)
+            {
+                error = "expected three comma separated numbers";
+                return false;
+            }
+
+            std::string number = range.substr(start, end - start);
+            number.erase(0, number.find_first_not_of(" \t"));
+            number.erase(number.find_last_not_of(" \t") + 1);
+
+            // strtod has to consume the whole number, so "0.5f", "1 2" or another separator are rejected.
+            char* parsed = nullptr;
+            *values[i]   = number.empty() ? 0.0 : std::strtod(number.c_str(), &parsed);
+
+            if (number.empty() || parsed != number.c_str() + number.size() || !std::isfinite(*values[i]))
+            {
+                error = number.find(',') != std::string::npos ? "expected three comma separated numbers" : "\"" + number + "\" is not a finite number";
+                return false;
+            }
+
+            start = end + 1;
+        }
+
+        if (!(min < max))
+        {
+            error = "min has to be below max";
+            return false;
+        }
+
+        if (!(precision > 0.0))
+        {
+            error = "precision has to be positive";
+            return false;
+        }
+
+        return true;
+    }
+
+    uint32_t GetQuantizationBits(double min, double max, double precision)
+    {
+        // Half a step at most, so (max - min) / (2^bits - 1) <= 2 * precision.
+        const double steps = std::ceil((max - min) / (2.0 * precision));
+        uint32_t     bits  = 1;
+
+        for (; bits < 32 && static_cast<double>((uint64_t(1) << bits) - 1) < steps; bits++)
+            ;
+
+        return static_cast<double>((uint64_t(1) << bits) - 1) < steps ? 0 : bits;
+    }
+} // namespace Lina
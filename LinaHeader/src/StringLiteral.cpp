@@ -0,0 +1,156 @@
+/*
+This file is a part of: Lina Engine
+https://github.com/inanevin/LinaEngine
+
+Author: Inan Evin
+http://www.inanevin.com
+
+Copyright (c) [2018-2020] [Inan Evin]
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+#include "StringLiteral.hpp"
+#include <cctype>
+
+namespace Lina
+{
+    std::vector<std::string> ReadStringLiterals(const std::string& line)
+    {
+        std::vector<std::string> literals;
+        const size_t             open = line.find('(');
+
+        if (open == std::string::npos)
+            return literals;
+
+        for (size_t i = open + 1; i < line.size() && line[i] != ')'; i++)
+        {
+            if (line[i] != '"')
+                continue;
+
+            // Find the closing quote, skipping escaped characters.
+            size_t end = i + 1;
+            while (end < line.size() && line[end] != '"')
+                end += line[end] == '\\' ? 2 : 1;
+
+            if (end >= line.size())
+                break;
+
+            literals.push_back(UnescapeStringLiteral(line.substr(i + 1, end - i - 1)));
+            i = end;
+        }
+
+        return literals;
+    }
+
+    std::string UnescapeStringLiteral(const std::string& body)
+    {
+        std::string str;
+        str.reserve(body.size());
+
+        for (size_t i = 0; i < body.size(); i++)
+        {
+            if (body[i] != '\\' || i + 1 == body.size())
+            {
+                str += body[i];
+                continue;
+            }
+
+            const char c = body[++i];
+            if (c >= '0' && c <= '7')
+            {
+                // Up to three octal digits.
+                int value = 0;
+                for (size_t digits = 0; digits < 3 && i < body.size() && body[i] >= '0' && body[i] <= '7'; digits++, i++)
+                    value = value * 8 + (body[i] - '0');
+                str += static_cast<char>(value);
+                i--;
+            }
+            else if (c == 'x')
+            {
+                int value = 0;
+                while (i + 1 < body.size() && std::isxdigit(static_cast<unsigned char>(body[i + 1])))
+                {
+                    const char digit = body[++i];
+                    value            = value * 16 + (digit <= '9' ? digit - '0' : (digit | 0x20) - 'a' + 10);
+                }
+                str += static_cast<char>(value);
+            }
+            else
+            {
+                switch (c)
+                {
+                case 'n':
+                    str += '\n';
+                    break;
+                case 't':
+                    str += '\t';
+                    break;
+                case 'r':
+                    str += '\r';
+                    break;
+                case 'a':
+                    str += '\a';
+                    break;
+                case 'b':
+                    str += '\b';
+                    break;
+                case 'f':
+                    str += '\f';
+                    break;
+                case 'v':
+                    str += '\v';
+                    break;
+                default:
+                    // \\, \", \' & \? stand for the character itself.
+                    str += c;
+                    break;
+                }
+            }
+        }
+
+        return str;
+    }
+
+    std::string EscapeStringLiteral(const std::string& str)
+    {
+        std::string body;
+        body.reserve(str.size());
+
+        for (const char c : str)
+        {
+            const unsigned char byte = static_cast<unsigned char>(c);
+
+            if (c == '"' || c == '\\')
+            {
+                body += '\\';
+                body += c;
+            }
+            else if (byte < 0x20 || byte == 0x7f)
+            {
+                const char octal[] = {'\\', static_cast<char>('0' + (byte >> 6)), static_cast<char>('0' + ((byte >> 3) & 7)), static_cast<char>('0' + (byte & 7))};
+                body.append(octal, sizeof(octal));
+            }
+            else
+                body += c;
+        }
+
+        return body;
+    }
+} // namespace Lina
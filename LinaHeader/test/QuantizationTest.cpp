@@ -0,0 +1,174 @@
+/*
+This file is a part of: Lina Engine
+https://github.com/inanevin/LinaEngine
+
+Author: Inan Evin
+http://www.inanevin.com
+
+Copyright (c) [2018-2020] [Inan Evin]
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+#include "Quantization.hpp"
+#include "ReflectedTypeTable.hpp"
+#include <cmath>
+#include <iostream>
+#include <limits>
+#include <string>
+#include <vector>
+
+// Round trips the values of ranged properties through the tool's bit selection & the registry's quantizers, asserting the
+// decoded value never moves further than GetQuantizationError, and that malformed ranges are rejected.
+namespace
+{
+    using namespace Lina;
+
+    int s_failures = 0;
+
+    void Check(bool condition, const std::string& what)
+    {
+        if (condition)
+            return;
+
+        std::cerr << "FAILED: " << what << std::endl;
+        s_failures++;
+    }
+
+    struct Sample
+    {
+        double m_double = 0.0;
+        float  m_float  = 0.0f;
+    };
+
+    // Same as the registry's REF_Quantized for a Double & a Float property.
+    uint32_t QuantizeDouble(const void* instance, const ReflectedQuantizedField& field)
+    {
+        return QuantizeValue(static_cast<const Sample*>(instance)->m_double, field);
+    }
+
+    void DequantizeDouble(void* instance, uint32_t value, const ReflectedQuantizedField& field)
+    {
+        static_cast<Sample*>(instance)->m_double = DequantizeValue(value, field);
+    }
+
+    uint32_t QuantizeFloat(const void* instance, const ReflectedQuantizedField& field)
+    {
+        return QuantizeValue(static_cast<double>(static_cast<const Sample*>(instance)->m_float), field);
+    }
+
+    void DequantizeFloat(void* instance, uint32_t value, const ReflectedQuantizedField& field)
+    {
+        static_cast<Sample*>(instance)->m_float = static_cast<float>(DequantizeValue(value, field));
+    }
+
+    void CheckRoundTrip(const std::string& range)
+    {
+        double      min = 0.0, max = 0.0, precision = 0.0;
+        std::string error = "";
+
+        if (!ParseQuantizationRange(range, min, max, precision, error))
+        {
+            Check(false, "\"" + range + "\" should parse, " + error);
+            return;
+        }
+
+        const uint32_t bits = GetQuantizationBits(min, max, precision);
+        Check(bits != 0, "\"" + range + "\" should fit in 32 bits");
+
+        ReflectedQuantizedField fields[2];
+        fields[0].m_min = fields[1].m_min = min;
+        fields[0].m_max = fields[1].m_max = max;
+        fields[0].m_bits = fields[1].m_bits = bits;
+        fields[0].m_quantize                = &QuantizeDouble;
+        fields[0].m_dequantize              = &DequantizeDouble;
+        fields[1].m_quantize                = &QuantizeFloat;
+        fields[1].m_dequantize              = &DequantizeFloat;
+
+        const double bound    = GetQuantizationError(fields[0]);
+        const double halfStep = (max - min) / (2.0 * static_cast<double>((uint64_t(1) << bits) - 1));
+        Check(halfStep <= precision, "\"" + range + "\" half step " + std::to_string(halfStep) + " exceeds the precision");
+
+        for (double value : {min, max, min + (max - min) * 0.5, min + (max - min) / 3.0, std::nextafter(max, min)})
+        {
+            Sample sample;
+            sample.m_double = value;
+            sample.m_float  = static_cast<float>(value);
+
+            std::vector<uint8_t> bytes;
+            {
+                ReflectedBitWriter writer(bytes);
+                EncodeQuantized(fields, 2, &sample, writer);
+            }
+
+            Check(bytes.size() == (bits * 2 + 7) / 8, "\"" + range + "\" should pack into " + std::to_string((bits * 2 + 7) / 8) + " bytes");
+
+            Sample             decoded;
+            ReflectedBitReader reader(bytes.data(), bytes.size());
+            Check(DecodeQuantized(fields, 2, &decoded, reader), "\"" + range + "\" should decode");
+
+            // Converting back to float adds at most half an ulp of the decoded value.
+            const double floatUlp = static_cast<double>(std::nextafter(decoded.m_float, std::numeric_limits<float>::infinity()) - decoded.m_float);
+            Check(std::fabs(value - decoded.m_double) <= bound, "\"" + range + "\" double " + std::to_string(value) + " decoded as " + std::to_string(decoded.m_double));
+            Check(std::fabs(static_cast<double>(sample.m_float) - static_cast<double>(decoded.m_float)) <= bound + floatUlp * 0.5,
+                  "\"" + range + "\" float " + std::to_string(value) + " decoded as " + std::to_string(decoded.m_float));
+        }
+    }
+
+    void CheckRejected(const std::string& range)
+    {
+        double      min = 0.0, max = 0.0, precision = 0.0;
+        std::string error = "";
+        Check(!ParseQuantizationRange(range, min, max, precision, error), "\"" + range + "\" should be rejected");
+        Check(!error.empty(), "\"" + range + "\" should describe why it is rejected");
+    }
+} // namespace
+
+int main()
+{
+    CheckRoundTrip("0, 1, 0.0001");
+    CheckRoundTrip("-100, 100, 0.01");
+    CheckRoundTrip("0,1000,0.5");
+    CheckRoundTrip("-1, 1, 1e-6");
+    CheckRoundTrip("  2.5 ,  7.25 , 0.125  ");
+
+    Check(GetQuantizationBits(0.0, 1.0, 0.0001) == 13, "\"0, 1, 0.0001\" should take 13 bits");
+    Check(GetQuantizationBits(0.0, 1.0, 1e-12) == 0, "a range needing more than 32 bits should be refused");
+
+    CheckRejected("");
+    CheckRejected("0, 1");
+    CheckRejected("0, 1, 0.1, 4");
+    CheckRejected("0; 1; 0.1");
+    CheckRejected("0 1 0.1");
+    CheckRejected("0, 1,");
+    CheckRejected("a, 1, 0.1");
+    CheckRejected("0, 1, 0.1f");
+    CheckRejected("0, 1 2, 0.1");
+    CheckRejected("1, 0, 0.1");
+    CheckRejected("0, 0, 0.1");
+    CheckRejected("0, 1, 0");
+    CheckRejected("0, 1, -0.1");
+    CheckRejected("0, inf, 0.1");
+    CheckRejected("nan, 1, 0.1");
+
+    if (s_failures != 0)
+        std::cerr << s_failures << " quantization check(s) failed." << std::endl;
+
+    return s_failures == 0 ? 0 : 1;
+}
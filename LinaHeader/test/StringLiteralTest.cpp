@@ -0,0 +1,176 @@
+/*
+This file is a part of: Lina Engine
+https://github.com/inanevin/LinaEngine
+
+Author: Inan Evin
+http://www.inanevin.com
+
+Copyright (c) [2018-2020] [Inan Evin]
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+#include "HeaderParser.hpp"
+#include "HeaderTool.hpp"
+#include "StringLiteral.hpp"
+#include <filesystem>
+#include <fstream>
+#include <iostream>
+#include <sstream>
+#include <string>
+
+// Runs macro arguments holding quotes, backslashes, parentheses & control characters through the parser & the generator,
+// asserting the parsed text is what the literal denotes & the generated string pool decodes back to it.
+namespace
+{
+    using namespace Lina;
+
+    int s_failures = 0;
+
+    void Check(bool condition, const std::string& what)
+    {
+        if (condition)
+            return;
+
+        std::cerr << "FAILED: " << what << std::endl;
+        s_failures++;
+    }
+
+    const char* s_header = "namespace Lina::ECS\n"
+                           "{\n"
+                           "    LINA_COMPONENT(\"Quoted \\\"Component\\\"\", \"ICON_FA_EYE\", \"Path\\\\To (Lights)\", \"true\", \"false\")\n"
+                           "    struct QuotedComponent : public Component\n"
+                           "    {\n"
+                           "        LINA_PROPERTY(\"Title, (with) comma\", \"Float\", \"tip \\\"q\\\"\\tend\\n\", \"\")\n"
+                           "        float m_value = 0.0f;\n"
+                           "    };\n"
+                           "}\n";
+
+    const std::string s_title    = "Quoted \"Component\"";
+    const std::string s_category = "Path\\To (Lights)";
+    const std::string s_property = "Title, (with) comma";
+    const std::string s_tooltip  = "tip \"q\"\tend\n";
+
+    void CheckParser()
+    {
+        LinaHeaderData data;
+        HeaderParser().Parse(s_header, data);
+
+        Check(data.m_components.size() == 1, "the component should be parsed");
+        if (data.m_components.size() != 1)
+            return;
+
+        const LinaComponent& component = data.m_components[0];
+        Check(component.m_title == s_title, "escaped quotes in the title");
+        Check(component.m_category == s_category, "escaped backslash & parentheses in the category");
+        Check(component.m_canAddComponent && !component.m_listenToValueChanged, "flags following an escaped literal");
+        Check(component.m_properties.size() == 1, "the property should be parsed");
+
+        if (component.m_properties.size() == 1)
+        {
+            const LinaProperty& property = component.m_properties[0];
+            Check(property.m_title == s_property, "comma & parentheses inside the property title");
+            Check(property.m_type == "Float", "type following a title with parentheses");
+            Check(property.m_tooltip == s_tooltip, "escaped quotes & control characters in the tooltip");
+            Check(property.m_propertyName == "m_value", "member name");
+        }
+    }
+
+    void CheckEscaping()
+    {
+        const std::string samples[] = {"", "plain", "\"", "\\", "a\\\"b", "\x01" "7 digit after a control character", "line\nbreak\r\n", "\x7f\x1f"};
+
+        for (const std::string& sample : samples)
+        {
+            const std::string body = EscapeStringLiteral(sample);
+            Check(UnescapeStringLiteral(body) == sample, "escape round trip of \"" + body + "\"");
+
+            // A literal body may not hold an unescaped quote or a raw line break.
+            bool escaped = false;
+            bool valid   = true;
+            for (const char c : body)
+            {
+                valid &= escaped || (c != '"' && c != '\n' && c != '\r');
+                escaped = !escaped && c == '\\';
+            }
+
+            Check(valid && !escaped, "\"" + body + "\" should be a valid literal body");
+        }
+    }
+
+    void CheckGenerator()
+    {
+        const std::filesystem::path root = std::filesystem::temp_directory_path() / "LinaHeaderStringLiteralTest";
+        std::filesystem::remove_all(root);
+        std::filesystem::create_directories(root / "include");
+        std::ofstream(root / "include" / "Quoted.hpp") << s_header;
+
+        // Smallest registry template, registering everything inline.
+        const std::filesystem::path registry = root / "Registry.cpp";
+        std::ofstream(registry) << "//INC_BEGIN\n//INC_END\n//REGFUNC_BEGIN\n//REGFUNC_END\n";
+
+        LinaModule module;
+        module.m_name         = "Test";
+        module.m_roots        = {(root / "include").string()};
+        module.m_registryPath = registry.string();
+
+        HeaderTool tool;
+        tool.AddModule(module);
+        tool.Run();
+        tool.Serialize();
+
+        std::ifstream     file(registry);
+        std::stringstream contents;
+        contents << file.rdbuf();
+        const std::string generated = contents.str();
+
+        // Decode the pool, one literal per line, the same way the compiler would.
+        std::string  pool  = "";
+        const size_t start = generated.find("s_reflectionStrings[] =");
+        const size_t end   = generated.find(";\n", start);
+        Check(start != std::string::npos && end != std::string::npos, "the registry should hold the string pool");
+
+        std::istringstream lines(start == std::string::npos ? "" : generated.substr(start, end - start));
+        std::string        line;
+        while (getline(lines, line))
+        {
+            const size_t open  = line.find('"');
+            const size_t close = line.rfind('"');
+            if (open != std::string::npos && close > open)
+                pool += UnescapeStringLiteral(line.substr(open + 1, close - open - 1));
+        }
+
+        for (const std::string* expected : {&s_title, &s_category, &s_property, &s_tooltip})
+            Check(pool.find(*expected + '\0') != std::string::npos, "the generated pool should hold \"" + EscapeStringLiteral(*expected) + "\"");
+
+        std::filesystem::remove_all(root);
+    }
+} // namespace
+
+int main()
+{
+    CheckParser();
+    CheckEscaping();
+    CheckGenerator();
+
+    if (s_failures != 0)
+        std::cerr << s_failures << " string literal check(s) failed." << std::endl;
+
+    return s_failures == 0 ? 0 : 1;
+}